@@ -0,0 +1,440 @@
+/**
+ * @file tabulix_bench.cpp
+ * @brief Benchmarks for building, rendering and exporting tables
+ *
+ * Every benchmark runs over synthetic tables described by four arguments:
+ * total cell count, column count, multiline content and Unicode theme.
+ * Throughput is reported in rows/s (items) and bytes/s, and the "allocs"
+ * counter reports heap allocations per iteration.
+ */
+
+#include <benchmark/benchmark.h>
+#include <tabulix/tabulix.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::atomic<size_t> g_allocations{0};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// std::pmr::new_delete_resource allocates through the aligned overloads
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    const auto align = static_cast<std::size_t>(alignment);
+    if (void* ptr = std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+/**
+ * @brief Shape and content of a synthetic table
+ */
+struct TableSpec {
+    int64_t cells;
+    int64_t columns;
+    bool multiline;
+    bool unicode;
+
+    [[nodiscard]] int64_t rows() const noexcept {
+        return std::max<int64_t>(1, cells / columns);
+    }
+
+    bool operator==(const TableSpec&) const = default;
+};
+
+TableSpec specFromState(const benchmark::State& state) {
+    return {state.range(0), state.range(1), state.range(2) != 0, state.range(3) != 0};
+}
+
+std::string makeCellValue(int64_t row, int64_t column, bool multiline) {
+    // Deterministic pseudo-random lengths between 1 and 16 characters
+    const auto hash = static_cast<uint64_t>(row * 2654435761 + column * 40503);
+    std::string value(1 + hash % 16, static_cast<char>('a' + column % 26));
+    if (multiline && (row + column) % 4 == 0) {
+        value += "\nline2";
+    }
+    return value;
+}
+
+std::vector<std::vector<std::string>> makeRows(const TableSpec& spec) {
+    std::vector<std::vector<std::string>> rows(static_cast<size_t>(spec.rows()));
+    for (int64_t r = 0; r < spec.rows(); ++r) {
+        auto& row = rows[static_cast<size_t>(r)];
+        row.reserve(static_cast<size_t>(spec.columns));
+        for (int64_t c = 0; c < spec.columns; ++c) {
+            row.push_back(makeCellValue(r, c, spec.multiline));
+        }
+    }
+    return rows;
+}
+
+tabulix::Table makeTable(const TableSpec& spec) {
+    std::vector<std::string> headers;
+    for (int64_t c = 0; c < spec.columns; ++c) {
+        headers.push_back("Column " + std::to_string(c));
+    }
+
+    tabulix::Table table(headers);
+    for (const auto& row : makeRows(spec)) {
+        table.addRow(row);
+    }
+    table.setTheme(spec.unicode ? tabulix::Theme::UNICODE_DOUBLE : tabulix::Theme::GRID);
+    return table;
+}
+
+/**
+ * @brief Keep the most recently built table around between benchmarks
+ *
+ * Building the largest tables dominates setup time, and consecutive
+ * benchmarks usually share the same arguments.
+ */
+const tabulix::Table& cachedTable(const TableSpec& spec) {
+    static std::unique_ptr<TableSpec> cachedSpec;
+    static std::unique_ptr<tabulix::Table> table;
+    if (!cachedSpec || !(*cachedSpec == spec)) {
+        table.reset();
+        table = std::make_unique<tabulix::Table>(makeTable(spec));
+        cachedSpec = std::make_unique<TableSpec>(spec);
+    }
+    return *table;
+}
+
+/**
+ * @brief Sink that discards output while counting bytes
+ */
+class CountingSink : public tabulix::OutputSink {
+public:
+    void write(std::string_view data) override {
+        benchmark::DoNotOptimize(data.data());
+        m_bytes += data.size();
+    }
+
+    [[nodiscard]] size_t bytes() const noexcept {
+        return m_bytes;
+    }
+
+private:
+    size_t m_bytes = 0;
+};
+
+/**
+ * @brief Measure allocations performed inside the timed loop
+ */
+class AllocationCounter {
+public:
+    AllocationCounter() : m_start(g_allocations.load(std::memory_order_relaxed)) {
+    }
+
+    void report(benchmark::State& state) const {
+        const size_t allocations = g_allocations.load(std::memory_order_relaxed) - m_start;
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    size_t m_start;
+};
+
+void reportThroughput(benchmark::State& state, const TableSpec& spec, size_t bytesPerIteration) {
+    state.SetItemsProcessed(state.iterations() * spec.rows());
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytesPerIteration));
+}
+
+void BM_AddRow(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto rows = makeRows(spec);
+
+    size_t inputBytes = 0;
+    for (const auto& row : rows) {
+        for (const auto& cell : row) {
+            inputBytes += cell.size();
+        }
+    }
+
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        tabulix::Table table;
+        for (const auto& row : rows) {
+            table.addRow(row);
+        }
+        benchmark::DoNotOptimize(table);
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, inputBytes);
+}
+
+void BM_AddRowArena(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto rows = makeRows(spec);
+
+    size_t inputBytes = 0;
+    for (const auto& row : rows) {
+        for (const auto& cell : row) {
+            inputBytes += cell.size();
+        }
+    }
+
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena;
+        tabulix::Table table(&arena);
+        for (const auto& row : rows) {
+            table.addRow(row);
+        }
+        benchmark::DoNotOptimize(table);
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, inputBytes);
+}
+
+void BM_ColumnWidths(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        auto widths = table.columnWidths();
+        benchmark::DoNotOptimize(widths);
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, 0);
+}
+
+/**
+ * @brief Sort a copy of the table by its first column; the copy is not timed
+ */
+void BM_SortBy(benchmark::State& state, unsigned threads) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+    const tabulix::SortOptions options{.threads = threads};
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        tabulix::Table copy = table;
+        const size_t start = g_allocations.load(std::memory_order_relaxed);
+        state.ResumeTiming();
+        copy.sortBy(0, options);
+        benchmark::DoNotOptimize(copy.rows().data());
+        allocations += g_allocations.load(std::memory_order_relaxed) - start;
+    }
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    reportThroughput(state, spec, 0);
+}
+
+void BM_RenderStr(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        const std::string output = table.str();
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+void BM_RenderStrParallel(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+    const tabulix::RenderOptions options{.threads = 0};
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        const std::string output = table.str(options);
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+void BM_RenderPage(benchmark::State& state) {
+    // One 50-row screen from the middle of the table: cost must not grow with the table
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+    const tabulix::RenderOptions options{.rowOffset = static_cast<size_t>(spec.rows() / 2), .rowLimit = 50};
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        const std::string output = table.str(options);
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    allocations.report(state);
+    state.SetItemsProcessed(state.iterations() * std::min<int64_t>(50, spec.rows() - spec.rows() / 2));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+void BM_RenderToSink(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        CountingSink sink;
+        table.renderTo(sink);
+        bytes = sink.bytes();
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+void BM_ColumnarRenderStr(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+
+    tabulix::ColumnarTable table;
+    for (const auto& row : makeRows(spec)) {
+        table.addRow(row);
+    }
+    table.setTheme(spec.unicode ? tabulix::Theme::UNICODE_DOUBLE : tabulix::Theme::GRID);
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        const std::string output = table.str();
+        bytes = output.size();
+        benchmark::DoNotOptimize(output.data());
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+void BM_Export(benchmark::State& state, tabulix::ExportFormat format) {
+    const TableSpec spec = specFromState(state);
+    const auto& table = cachedTable(spec);
+    const auto exporter = tabulix::Exporter::create(format);
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        CountingSink sink;
+        exporter->toSink(table, sink);
+        bytes = sink.bytes();
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+/**
+ * @brief Parse the CSV export of the table into an arena-backed Table
+ */
+void BM_ImportCsv(benchmark::State& state, unsigned threads) {
+    const TableSpec spec = specFromState(state);
+    const std::string csv = tabulix::CsvExporter().toString(cachedTable(spec));
+    const tabulix::CsvImporter importer;
+    const tabulix::ImportOptions options{.threads = threads};
+
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        std::pmr::monotonic_buffer_resource arena;
+        const tabulix::Table table = importer.fromString(csv, options, &arena);
+        benchmark::DoNotOptimize(table.rowCount());
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, csv.size());
+}
+
+/**
+ * @brief Open a binary snapshot and render it, without building a Table
+ */
+void BM_RenderSnapshot(benchmark::State& state) {
+    const TableSpec spec = specFromState(state);
+    const std::string data = tabulix::BinaryExporter().toString(cachedTable(spec));
+
+    size_t bytes = 0;
+    AllocationCounter allocations;
+    for (auto _ : state) {
+        const auto snapshot = tabulix::TableSnapshot::fromString(data);
+        const std::string out = snapshot.str();
+        bytes = out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    allocations.report(state);
+    reportThroughput(state, spec, bytes);
+}
+
+/**
+ * @brief Sweep table sizes from 10 to 10M cells over narrow and wide shapes
+ */
+void tableArguments(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"cells", "columns", "multiline", "unicode"});
+    for (int64_t cells = 10; cells <= 10'000'000; cells *= 10) {
+        for (int64_t columns : {4, 64}) {
+            if (columns > cells) {
+                continue;
+            }
+            bench->Args({cells, columns, 0, 0});
+            bench->Args({cells, columns, 1, 0});
+            bench->Args({cells, columns, 0, 1});
+        }
+    }
+    bench->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+BENCHMARK(BM_AddRow)->Apply(tableArguments);
+BENCHMARK(BM_AddRowArena)->Apply(tableArguments);
+BENCHMARK(BM_ColumnWidths)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_SortBy, sequential, 1u)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_SortBy, parallel, 0u)->Apply(tableArguments)->UseRealTime();
+BENCHMARK(BM_RenderStr)->Apply(tableArguments);
+BENCHMARK(BM_RenderStrParallel)->Apply(tableArguments)->UseRealTime();
+BENCHMARK(BM_RenderPage)->Apply(tableArguments);
+BENCHMARK(BM_RenderToSink)->Apply(tableArguments);
+BENCHMARK(BM_ColumnarRenderStr)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, text, tabulix::ExportFormat::TEXT)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, markdown, tabulix::ExportFormat::MARKDOWN)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, html, tabulix::ExportFormat::HTML)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, csv, tabulix::ExportFormat::CSV)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, json, tabulix::ExportFormat::JSON)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_Export, binary, tabulix::ExportFormat::BINARY)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_ImportCsv, sequential, 1u)->Apply(tableArguments);
+BENCHMARK_CAPTURE(BM_ImportCsv, parallel, 0u)->Apply(tableArguments)->UseRealTime();
+BENCHMARK(BM_RenderSnapshot)->Apply(tableArguments);
+
+BENCHMARK_MAIN();
@@ -7,40 +7,180 @@
 #define TABULIX_CORE_CELL_HPP
 
 #include <string>
+#include <string_view>
 #include <optional>
+#include <concepts>
+#include <memory_resource>
+#include <cstdint>
+#include <variant>
+#include "format.hpp"
 #include "../styling/alignment.hpp"
 
 namespace tabulix {
 
+/**
+ * @brief Character types, whose values are text rather than numbers
+ *
+ * signed char and unsigned char are not among them: they are the types of
+ * int8_t and uint8_t.
+ */
+template <typename T>
+concept CellCharacter = std::same_as<T, char> || std::same_as<T, wchar_t> || std::same_as<T, char8_t>
+                        || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+/**
+ * @brief Arithmetic types a cell can hold as a number (bool and character types excluded)
+ */
+template <typename T>
+concept CellNumber = ((std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>) && !CellCharacter<T>;
+
 /**
  * @class Cell
  * @brief Represents a cell in a table
+ *
+ * Cell content is allocated from the cell's memory resource, so cells
+ * created inside a Row or Table backed by an arena live in that arena.
  */
 class Cell {
 public:
+    /**
+     * @brief Allocator used for the cell content
+     */
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     /**
      * @brief Default constructor
      */
     Cell() = default;
 
+    /**
+     * @brief Constructor with allocator
+     * @param alloc Allocator for the cell content
+     */
+    explicit Cell(const allocator_type& alloc) noexcept;
+
     /**
      * @brief Constructor with value
      * @param value Cell content
+     * @param alloc Allocator for the cell content
+     */
+    explicit Cell(std::string_view value, const allocator_type& alloc = {});
+
+    /**
+     * @brief Constructor taking over a string's buffer
+     *
+     * The buffer is adopted without copying when @p value uses the same
+     * memory resource as @p alloc; otherwise it is copied once.
+     *
+     * @param value Cell content to move from
+     * @param alloc Allocator for the cell content
+     */
+    template <typename String>
+    requires std::same_as<String, std::pmr::string>
+    explicit Cell(String&& value, const allocator_type& alloc = {});
+
+    /**
+     * @brief Constructor with a numeric value
+     *
+     * The number is stored as int64_t or double and only turned into text
+     * when the cell is measured, rendered or exported.
+     *
+     * @param value Cell value
+     * @param alloc Allocator for the cell content
+     */
+    template <CellNumber T>
+    explicit Cell(T value, const allocator_type& alloc = {});
+
+    /**
+     * @brief Copy constructor
+     */
+    Cell(const Cell&) = default;
+
+    /**
+     * @brief Move constructor
+     */
+    Cell(Cell&&) noexcept = default;
+
+    /**
+     * @brief Allocator-extended copy constructor
+     * @param other Cell to copy
+     * @param alloc Allocator for the cell content
+     */
+    Cell(const Cell& other, const allocator_type& alloc);
+
+    /**
+     * @brief Allocator-extended move constructor
+     * @param other Cell to move from
+     * @param alloc Allocator for the cell content
      */
-    explicit Cell(std::string value);
+    Cell(Cell&& other, const allocator_type& alloc);
+
+    Cell& operator=(const Cell&) = default;
+    Cell& operator=(Cell&&) = default;
+
+    /**
+     * @brief Get the allocator used for the cell content
+     * @return Cell allocator
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+    /**
+     * @brief Numeric value of a cell
+     */
+    using Number = std::variant<int64_t, double>;
+
+    /**
+     * @brief Get the text content
+     *
+     * Numeric cells have no text until they are formatted: check isNumeric(),
+     * or use text() or format() for cells that may hold a number.
+     *
+     * @return View of the text, valid until the cell is modified (empty for numeric cells)
+     */
+    [[nodiscard]] std::string_view value() const noexcept;
+
+    /**
+     * @brief Get the cell content as text, formatting numbers
+     * @param spec Format applied to numeric cells
+     * @return Copy of the text of a text cell, or the formatted number
+     */
+    [[nodiscard]] std::string text(const FormatSpec& spec = {}) const;
+
+    /**
+     * @brief Get the numeric value
+     * @return The number, or std::nullopt for text cells
+     */
+    [[nodiscard]] std::optional<Number> number() const noexcept;
+
+    /**
+     * @brief Check whether the cell holds a number
+     * @return true for numeric cells, false for text cells
+     */
+    [[nodiscard]] bool isNumeric() const noexcept;
 
     /**
-     * @brief Get the cell content
-     * @return Cell content
+     * @brief Get the cell content as text
+     * @param buffer Scratch storage numeric cells are formatted into
+     * @param spec Format applied to numeric cells
+     * @return The text of a text cell, or the formatted number stored in
+     *         @p buffer (valid until the buffer is modified)
      */
-    [[nodiscard]] const std::string& value() const noexcept;
+    [[nodiscard]] std::string_view format(std::string& buffer, const FormatSpec& spec = {}) const;
 
     /**
-     * @brief Set the cell content
+     * @brief Set the text content
      * @param value New cell content
      * @return Reference to this cell for method chaining
      */
-    Cell& setValue(std::string value);
+    Cell& setValue(std::string_view value);
+
+    /**
+     * @brief Set a numeric value
+     * @param value New cell value
+     * @return Reference to this cell for method chaining
+     */
+    template <CellNumber T>
+    Cell& setValue(T value);
 
     /**
      * @brief Get the cell alignment
@@ -63,15 +203,49 @@ public:
 
     /**
      * @brief Get the cell width
-     * @return Width of the cell content in characters
+     * @param spec Format applied to numeric cells
+     * @return Width of the cell content in terminal columns
      */
-    [[nodiscard]] size_t width() const;
+    [[nodiscard]] size_t width(const FormatSpec& spec = {}) const;
 
 private:
-    std::string m_value;
+    std::pmr::string m_value;
+    std::variant<std::monostate, int64_t, double> m_number;
     std::optional<Alignment> m_alignment;
+
+    /**
+     * @brief Convert an arithmetic value to the stored representation
+     */
+    template <CellNumber T>
+    static std::variant<std::monostate, int64_t, double> toStored(T value) noexcept;
 };
 
+// Template implementation
+template <typename String>
+requires std::same_as<String, std::pmr::string>
+Cell::Cell(String&& value, const allocator_type& alloc) : m_value(std::move(value), alloc) {
+}
+
+template <CellNumber T>
+Cell::Cell(T value, const allocator_type& alloc) : m_value(alloc), m_number(toStored(value)) {
+}
+
+template <CellNumber T>
+Cell& Cell::setValue(T value) {
+    m_value.clear();
+    m_number = toStored(value);
+    return *this;
+}
+
+template <CellNumber T>
+std::variant<std::monostate, int64_t, double> Cell::toStored(T value) noexcept {
+    if constexpr (std::floating_point<T>) {
+        return static_cast<double>(value);
+    } else {
+        return static_cast<int64_t>(value);
+    }
+}
+
 } // namespace tabulix
 
 #endif // TABULIX_CORE_CELL_HPP
@@ -0,0 +1,329 @@
+/**
+ * @file columnar_table.hpp
+ * @brief Definition of the ColumnarTable class
+ */
+
+#ifndef TABULIX_CORE_COLUMNAR_TABLE_HPP
+#define TABULIX_CORE_COLUMNAR_TABLE_HPP
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <optional>
+#include <concepts>
+#include <map>
+#include <span>
+#include <utility>
+
+#include "render_options.hpp"
+#include "renderer.hpp"
+#include "row.hpp"
+#include "sink.hpp"
+#include "table.hpp"
+#include "../styling/theme.hpp"
+#include "../styling/border.hpp"
+#include "../styling/alignment.hpp"
+
+namespace tabulix {
+
+/**
+ * @class ColumnarTable
+ * @brief Table that stores its cells column by column
+ *
+ * Every column keeps all of its cell contents in one contiguous string
+ * arena with an offset array marking where each cell starts, so a table
+ * costs a handful of allocations per column instead of one per cell.
+ * Cell alignment overrides are rare and live in a sparse side table.
+ * Rendering produces exactly the same output as Table, and every Exporter
+ * accepts a ColumnarTable as well.
+ *
+ * Cells are text only: numeric cells added through a Row are stored in
+ * their default format, and there are no column formats. Operations that
+ * need a Table, such as sorting, work on the copy made by toTable().
+ */
+class ColumnarTable {
+public:
+    /**
+     * @brief Default constructor
+     */
+    ColumnarTable() = default;
+
+    /**
+     * @brief Constructor with headers
+     * @param headers Vector of header strings
+     */
+    explicit ColumnarTable(const std::vector<std::string>& headers);
+
+    /**
+     * @brief Constructor with headers
+     * @param headers Initializer list of header strings
+     */
+    ColumnarTable(std::initializer_list<std::string> headers);
+
+    /**
+     * @brief Add a header row to the table
+     * @param headers Vector of header strings
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& addHeader(const std::vector<std::string>& headers);
+
+    /**
+     * @brief Add a header row to the table
+     * @param headers Initializer list of header strings
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& addHeader(std::initializer_list<std::string> headers);
+
+    /**
+     * @brief Add a row to the table
+     * @param cells Vector of cell values
+     * @return Reference to this table for method chaining
+     */
+    template <typename T>
+    requires std::convertible_to<const T&, std::string_view>
+    ColumnarTable& addRow(const std::vector<T>& cells);
+
+    /**
+     * @brief Add a row to the table
+     * @param cells Initializer list of cell values
+     * @return Reference to this table for method chaining
+     */
+    template <typename T>
+    requires std::convertible_to<const T&, std::string_view>
+    ColumnarTable& addRow(std::initializer_list<T> cells);
+
+    /**
+     * @brief Add a pre-constructed Row to the table, keeping cell alignments
+     * @param row Row object to add
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& addRow(const Row& row);
+
+    /**
+     * @brief Override the alignment of a single data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @param alignment Alignment to apply
+     * @return Reference to this table for method chaining
+     * @throws std::out_of_range if the row or column does not exist
+     */
+    ColumnarTable& setCellAlignment(size_t rowIndex, size_t columnIndex, Alignment alignment);
+
+    /**
+     * @brief Set the theme for the table
+     * @param theme Theme to apply
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& setTheme(Theme theme);
+
+    /**
+     * @brief Set custom border style
+     * @param border Border style to apply
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& setBorder(const Border& border);
+
+    /**
+     * @brief Set alignment for a specific column
+     * @param columnIndex Index of the column (0-based)
+     * @param alignment Alignment to apply
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& setColumnAlignment(size_t columnIndex, Alignment alignment);
+
+    /**
+     * @brief Set the width for a specific column
+     * @param columnIndex Index of the column (0-based)
+     * @param width Width in characters, or std::nullopt for auto-sizing
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& setColumnWidth(size_t columnIndex, std::optional<size_t> width);
+
+    /**
+     * @brief Get the content of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return View of the cell content, valid until the table is modified
+     * @throws std::out_of_range if the row or column does not exist
+     */
+    [[nodiscard]] std::string_view cell(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the header row of the table
+     * @return Header cells, or std::nullopt if the table has no header
+     */
+    [[nodiscard]] const std::optional<std::vector<std::string>>& header() const noexcept;
+
+    /**
+     * @brief Get the alignment override of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return Cell alignment or std::nullopt if not set
+     */
+    [[nodiscard]] std::optional<Alignment> cellAlignment(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the default alignment of a column
+     * @param columnIndex Index of the column (0-based)
+     * @return Alignment of the column (LEFT if out of range)
+     */
+    [[nodiscard]] Alignment columnAlignment(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the border the table is drawn with
+     * @return Border of the table
+     */
+    [[nodiscard]] const Border& border() const noexcept;
+
+    /**
+     * @brief Get the number of rows in the table (including header)
+     * @return Number of rows
+     */
+    [[nodiscard]] size_t rowCount() const noexcept;
+
+    /**
+     * @brief Get the number of columns in the table
+     * @return Number of columns
+     */
+    [[nodiscard]] size_t columnCount() const noexcept;
+
+    /**
+     * @brief Get the number of columns holding cells
+     *
+     * Every data row has a cell, possibly empty, in each of these columns.
+     *
+     * @return Number of cells in the widest row added
+     */
+    [[nodiscard]] size_t storedColumnCount() const noexcept;
+
+    /**
+     * @brief Get the column widths used when rendering the table
+     * @return Vector of column widths in characters
+     */
+    [[nodiscard]] std::vector<size_t> columnWidths() const;
+
+    /**
+     * @brief Check if the table is empty (has no rows)
+     * @return true if empty, false otherwise
+     */
+    [[nodiscard]] bool empty() const noexcept;
+
+    /**
+     * @brief Clear all rows from the table
+     * @return Reference to this table for method chaining
+     */
+    ColumnarTable& clear() noexcept;
+
+    /**
+     * @brief Copy the table into a row-major Table
+     * @param alloc Allocator for rows and cell contents of the table
+     * @return Table with the same cells, styling and fixed widths
+     */
+    [[nodiscard]] Table toTable(const Table::allocator_type& alloc = {}) const;
+
+    /**
+     * @brief Get a string representation of the table
+     * @param options Rendering options, honored as by Table::str
+     * @return Formatted table as string
+     */
+    [[nodiscard]] std::string str(const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Render the table into an output sink in bounded chunks
+     * @param sink Destination for the rendered table
+     * @param options Rendering options, honored as by Table::renderTo
+     */
+    void renderTo(OutputSink& sink, const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Output stream operator overload
+     * @param os Output stream
+     * @param table Table to output
+     * @return Reference to the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const ColumnarTable& table);
+
+private:
+    /**
+     * @brief Contiguous storage of one column
+     *
+     * Cell r spans [offsets[r], offsets[r + 1]) of the arena.
+     */
+    struct Column {
+        std::string arena;
+        std::vector<size_t> offsets{0};
+    };
+
+    std::optional<std::vector<std::string>> m_header;
+    std::vector<Column> m_columns;
+    size_t m_rows = 0;
+    size_t m_firstRowSize = 0;
+    std::map<std::pair<size_t, size_t>, Alignment> m_cellAlignments;
+    Theme m_theme = Theme::GRID;
+    Border m_border = getBorderForTheme(m_theme);
+    std::vector<Alignment> m_columnAlignments;
+    std::vector<std::optional<size_t>> m_columnWidths;
+
+    /**
+     * @brief Append one row of cell values to the column arenas
+     * @param cells Cell values of the row
+     */
+    void appendRow(std::span<const std::string_view> cells);
+
+    /**
+     * @brief Calculate the column widths based on content
+     * @param sampleRows Number of leading data rows to measure (all rows if unset)
+     * @return Vector of column widths
+     */
+    [[nodiscard]] std::vector<size_t> calculateColumnWidths(std::optional<size_t> sampleRows = std::nullopt) const;
+
+    /**
+     * @brief View the cells of a data row for rendering, alignment overrides excluded
+     * @param rowIndex Index of the data row
+     * @param firstColumn Index of the first column to view
+     * @param cells Views to fill, one per column
+     */
+    void viewRow(size_t rowIndex, size_t firstColumn, std::span<CellView> cells) const;
+
+    /**
+     * @brief Write data rows with separators between them
+     * @param out Writer receiving the rows
+     * @param renderer Renderer of the visible columns
+     * @param firstColumn Index of the first visible column
+     * @param columns Number of visible columns
+     * @param firstRow Index of the first data row to write
+     * @param lastRow Index past the last data row to write
+     * @param endsTable Leave out the separator after the last row
+     */
+    void writeRows(BufferedWriter& out, const Renderer& renderer, size_t firstColumn, size_t columns,
+                   size_t firstRow, size_t lastRow, bool endsTable) const;
+
+    /**
+     * @brief Render the table into a buffered writer
+     * @param out Writer receiving the formatted table
+     * @param options Rendering options
+     */
+    void render(BufferedWriter& out, const RenderOptions& options) const;
+};
+
+// Template implementation
+template <typename T>
+requires std::convertible_to<const T&, std::string_view>
+ColumnarTable& ColumnarTable::addRow(const std::vector<T>& cells) {
+    std::vector<std::string_view> views(cells.begin(), cells.end());
+    appendRow(views);
+    return *this;
+}
+
+template <typename T>
+requires std::convertible_to<const T&, std::string_view>
+ColumnarTable& ColumnarTable::addRow(std::initializer_list<T> cells) {
+    std::vector<std::string_view> views(cells.begin(), cells.end());
+    appendRow(views);
+    return *this;
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_COLUMNAR_TABLE_HPP
@@ -0,0 +1,84 @@
+/**
+ * @file format.hpp
+ * @brief Format specifications for numeric cells
+ */
+
+#ifndef TABULIX_CORE_FORMAT_HPP
+#define TABULIX_CORE_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tabulix {
+
+/**
+ * @struct FormatSpec
+ * @brief How numeric cells of a column are turned into text
+ *
+ * Uses the sign, precision and type parts of the std::format standard
+ * format specification (fill, alignment and width come from the column):
+ * <tt>[sign][.precision][type]</tt> with sign one of <tt>+ - space</tt> and
+ * type one of <tt>d x X o b</tt> for integers or <tt>f e g</tt> for floating
+ * point values. Integers formatted with a floating-point type are converted
+ * to double; floating-point values ignore integer types. Without a type,
+ * integers are written in decimal and floating-point values in their
+ * shortest round-trip form, as std::format("{}") does.
+ */
+struct FormatSpec {
+    char sign = '-';                ///< '+' for all numbers, ' ' to pad non-negative ones, '-' for negative only
+    std::optional<int> precision;   ///< Digits after the decimal point (f, e) or significant digits (g)
+    char type = '\0';               ///< Presentation type, or '\0' for the default
+
+    /**
+     * @brief Parse a format specification such as ".2f" or "+x"
+     * @param spec Specification without the surrounding "{:" and "}"
+     * @return The parsed specification
+     * @throws std::invalid_argument if the specification is malformed or unsupported
+     */
+    [[nodiscard]] static FormatSpec parse(std::string_view spec);
+};
+
+/**
+ * @brief Format an integer into a character buffer
+ * @param first Start of the buffer
+ * @param last End of the buffer
+ * @param value Value to format
+ * @param spec Format to apply
+ * @return End of the written text, or nullptr if the buffer is too small
+ */
+[[nodiscard]] char* formatNumber(char* first, char* last, int64_t value, const FormatSpec& spec) noexcept;
+
+/**
+ * @brief Format a floating-point value into a character buffer
+ * @param first Start of the buffer
+ * @param last End of the buffer
+ * @param value Value to format
+ * @param spec Format to apply
+ * @return End of the written text, or nullptr if the buffer is too small
+ */
+[[nodiscard]] char* formatNumber(char* first, char* last, double value, const FormatSpec& spec) noexcept;
+
+/**
+ * @brief Format an integer into a reusable string buffer
+ * @param buffer Buffer receiving the text; grown as needed and reused across calls
+ * @param value Value to format
+ * @param spec Format to apply
+ * @return View of the formatted text inside @p buffer
+ */
+[[nodiscard]] std::string_view formatNumber(std::string& buffer, int64_t value, const FormatSpec& spec);
+
+/**
+ * @brief Format a floating-point value into a reusable string buffer
+ * @param buffer Buffer receiving the text; grown as needed and reused across calls
+ * @param value Value to format
+ * @param spec Format to apply
+ * @return View of the formatted text inside @p buffer
+ */
+[[nodiscard]] std::string_view formatNumber(std::string& buffer, double value, const FormatSpec& spec);
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_FORMAT_HPP
@@ -0,0 +1,194 @@
+/**
+ * @file live_table.hpp
+ * @brief Definition of the LiveTable class
+ */
+
+#ifndef TABULIX_CORE_LIVE_TABLE_HPP
+#define TABULIX_CORE_LIVE_TABLE_HPP
+
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "renderer.hpp"
+#include "sink.hpp"
+#include "table.hpp"
+
+namespace tabulix {
+
+/**
+ * @class LiveTable
+ * @brief A table kept on a terminal and redrawn incrementally
+ *
+ * Watch-style tools append rows and update cells between ticks, then call
+ * redraw(). The first redraw prints the whole table; later ones only move
+ * the cursor with ANSI escape sequences and rewrite the rows that changed,
+ * plus the rows appended since the last redraw. Column widths never shrink
+ * while the table is live, so the whole table is only drawn again when a
+ * column has to grow, the theme, alignment or format of the table changes,
+ * or invalidate() is called. Only invalidate() lets the widths shrink again;
+ * a full redraw over the table erases the rest of every line it writes.
+ *
+ * The cursor is expected to stay below the table between redraws, and the
+ * table must fit on the screen: rows scrolled out of view cannot be updated.
+ */
+class LiveTable {
+public:
+    /**
+     * @brief Constructor
+     * @param table Initial content (header, rows and styling)
+     */
+    explicit LiveTable(Table table = Table());
+
+    /**
+     * @brief Get the underlying table
+     * @return The table with all rows and updates applied
+     */
+    [[nodiscard]] const Table& table() const noexcept;
+
+    /**
+     * @brief Append a row
+     * @param cells Cell values
+     * @return Reference to this live table for method chaining
+     */
+    LiveTable& addRow(std::initializer_list<std::string> cells);
+
+    /**
+     * @brief Append a row
+     * @param row Row to copy
+     * @return Reference to this live table for method chaining
+     */
+    LiveTable& addRow(const Row& row);
+
+    /**
+     * @brief Append a row, moving its cells into the table
+     * @param row Row to move from
+     * @return Reference to this live table for method chaining
+     */
+    LiveTable& addRow(Row&& row);
+
+    /**
+     * @brief Append a row built in place from its cell values
+     * @param cells Cell values (see Table::emplaceRow)
+     * @return Reference to this live table for method chaining
+     */
+    template <typename... Cells>
+    LiveTable& emplaceRow(Cells&&... cells);
+
+    /**
+     * @brief Replace the content of a data cell and mark its row for redrawing
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @param value New cell content
+     * @return Reference to this live table for method chaining
+     * @throws std::out_of_range if the row or column does not exist
+     */
+    LiveTable& setValue(size_t rowIndex, size_t columnIndex, std::string_view value);
+
+    /**
+     * @brief Set the theme; the next redraw draws the whole table
+     * @param theme Theme to apply
+     * @return Reference to this live table for method chaining
+     */
+    LiveTable& setTheme(Theme theme);
+
+    /**
+     * @brief Set alignment for a column; the next redraw draws the whole table
+     * @param columnIndex Index of the column (0-based)
+     * @param alignment Alignment to apply
+     * @return Reference to this live table for method chaining
+     */
+    LiveTable& setColumnAlignment(size_t columnIndex, Alignment alignment);
+
+    /**
+     * @brief Set the numeric format of a column; the next redraw draws the whole table
+     * @param columnIndex Index of the column (0-based)
+     * @param spec Format specification (see FormatSpec)
+     * @return Reference to this live table for method chaining
+     * @throws std::invalid_argument if the specification is not supported
+     */
+    LiveTable& setColumnFormat(size_t columnIndex, std::string_view spec);
+
+    /**
+     * @brief Forget what is on the screen, e.g. after it was cleared
+     *
+     * The next redraw prints the whole table at the cursor position.
+     */
+    void invalidate() noexcept;
+
+    /**
+     * @brief Bring the terminal up to date with the table
+     *
+     * All escape sequences and lines of one redraw are written to the sink
+     * with a single write, followed by a flush.
+     *
+     * @param sink Terminal output, e.g. a FileDescriptorSink over stdout
+     */
+    void redraw(OutputSink& sink);
+
+private:
+    Table m_table;
+
+    // Layout of the table on the screen, in lines from the top border
+    std::vector<size_t> m_widths;
+    std::vector<size_t> m_rowStarts;
+    std::vector<size_t> m_rowLines;
+    size_t m_bodyStart = 0;
+    size_t m_lines = 0;
+    bool m_drawn = false;
+    bool m_layoutChanged = true;
+
+    // Drawn rows whose content changed since the last redraw
+    std::vector<bool> m_dirty;
+
+    // Scratch state of a redraw
+    std::string m_frame;
+    size_t m_cursor = 0;
+    std::vector<Alignment> m_alignments;
+    std::vector<CellView> m_cells;
+    std::vector<std::string> m_numbers;
+
+    /**
+     * @brief Get the cell views of a row with numbers formatted
+     * @param row Row to view
+     * @return Views valid until the next call
+     */
+    std::span<const CellView> viewRow(const Row& row);
+
+    /**
+     * @brief Write a row and return the number of lines it took
+     * @param out Writer over the frame
+     * @param renderer Renderer of the current layout
+     * @param row Row to write
+     * @return Number of lines written
+     */
+    size_t writeRow(BufferedWriter& out, const Renderer& renderer, const Row& row);
+
+    /**
+     * @brief Redraw every row from a given one down to the bottom border
+     * @param out Writer over the frame
+     * @param renderer Renderer of the current layout
+     * @param first Index of the first row to draw
+     */
+    void drawFrom(BufferedWriter& out, const Renderer& renderer, size_t first);
+
+    /**
+     * @brief Move the cursor to the start of a line of the table
+     * @param out Writer over the frame
+     * @param line Target line, counted from the top border
+     */
+    void moveTo(BufferedWriter& out, size_t line);
+};
+
+// Template implementation
+template <typename... Cells>
+LiveTable& LiveTable::emplaceRow(Cells&&... cells) {
+    m_table.emplaceRow(std::forward<Cells>(cells)...);
+    return *this;
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_LIVE_TABLE_HPP
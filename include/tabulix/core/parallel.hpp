@@ -0,0 +1,110 @@
+/**
+ * @file parallel.hpp
+ * @brief Minimal fork-join helpers for data-parallel table operations
+ */
+
+#ifndef TABULIX_CORE_PARALLEL_HPP
+#define TABULIX_CORE_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include "sink.hpp"
+
+namespace tabulix {
+
+/**
+ * @brief Resolve a requested thread count
+ * @param threads Requested number of threads, or 0 for one per hardware thread
+ * @return Number of threads to use (at least 1)
+ */
+[[nodiscard]] unsigned resolveThreadCount(unsigned threads) noexcept;
+
+/**
+ * @brief Run a task for every index in [0, count) on up to a number of threads
+ *
+ * Threads claim the next unclaimed index until none are left; the calling
+ * thread takes part, the others come from a pool of worker threads that is
+ * started on first use and kept for later calls. Calls may be nested or
+ * made from several threads at once. The call returns once every claimed
+ * task has finished. If a task throws, the remaining indices are skipped
+ * and the first exception is rethrown on the calling thread.
+ *
+ * @param count Number of tasks
+ * @param threads Number of threads to use (0 for one per hardware thread)
+ * @param task Callable receiving the task index
+ */
+void parallelFor(size_t count, unsigned threads, const std::function<void(size_t)>& task);
+
+/**
+ * @brief Render blocks of output on up to a number of threads and write them in order
+ *
+ * Every block is rendered into a buffer of its own, and at most twice
+ * @p threads rendered blocks are held. Whichever thread completes the next
+ * block due writes it to @p out, together with any following blocks that
+ * are ready, while the other threads go on rendering. With one thread the
+ * blocks are rendered straight into @p out. If rendering or writing throws,
+ * the remaining blocks are skipped and the first exception is rethrown.
+ *
+ * @param out Writer receiving the blocks in index order
+ * @param blocks Number of blocks
+ * @param threads Number of threads to use (0 for one per hardware thread)
+ * @param render Callable receiving the block index and the writer to render it into
+ */
+void parallelWrite(BufferedWriter& out, size_t blocks, unsigned threads,
+                   const std::function<void(size_t, BufferedWriter&)>& render);
+
+/**
+ * @brief Sort a range on up to a number of threads
+ *
+ * The range is cut into one run per thread, the runs are sorted
+ * concurrently and then merged pairwise, the merges of one pass also
+ * running concurrently. Stable sorting keeps a stable result since runs
+ * are merged in order. @p compare is called from several threads at once.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param compare Strict weak ordering of the elements
+ * @param threads Number of threads to use (0 for one per hardware thread)
+ * @param stable Keep equal elements in their original order
+ */
+template <std::random_access_iterator Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare compare, unsigned threads, bool stable);
+
+// Template implementation
+template <std::random_access_iterator Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare compare, unsigned threads, bool stable) {
+    auto sortRun = [&](Iterator runFirst, Iterator runLast) {
+        if (stable) {
+            std::stable_sort(runFirst, runLast, compare);
+        } else {
+            std::sort(runFirst, runLast, compare);
+        }
+    };
+
+    const auto size = static_cast<size_t>(last - first);
+    const size_t runs = std::min<size_t>(resolveThreadCount(threads), size);
+    if (runs <= 1) {
+        sortRun(first, last);
+        return;
+    }
+
+    auto bound = [&](size_t run) { return first + static_cast<std::ptrdiff_t>(size * run / runs); };
+    parallelFor(runs, static_cast<unsigned>(runs), [&](size_t run) { sortRun(bound(run), bound(run + 1)); });
+    for (size_t width = 1; width < runs; width *= 2) {
+        const size_t merges = (runs + 2 * width - 1) / (2 * width);
+        parallelFor(merges, static_cast<unsigned>(runs), [&](size_t merge) {
+            const size_t low = merge * 2 * width;
+            const size_t middle = std::min(low + width, runs);
+            const size_t high = std::min(low + 2 * width, runs);
+            if (middle < high) {
+                std::inplace_merge(bound(low), bound(middle), bound(high), compare);
+            }
+        });
+    }
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_PARALLEL_HPP
@@ -0,0 +1,99 @@
+/**
+ * @file render_options.hpp
+ * @brief Definition of the RenderOptions structure
+ */
+
+#ifndef TABULIX_CORE_RENDER_OPTIONS_HPP
+#define TABULIX_CORE_RENDER_OPTIONS_HPP
+
+#include <cstddef>
+#include <optional>
+#include "../styling/border.hpp"
+
+namespace tabulix {
+
+/**
+ * @enum Overflow
+ * @brief What happens to cell lines wider than their column
+ */
+enum class Overflow {
+    TRUNCATE, ///< Cut the line at the column width
+    WRAP      ///< Continue the line on the next rows of the cell
+};
+
+/**
+ * @struct RenderOptions
+ * @brief Per-call settings for rendering a table
+ *
+ * The defaults reproduce the plain single-threaded output, so passing a
+ * default-constructed instance is the same as passing nothing.
+ */
+struct RenderOptions {
+    /**
+     * @brief Number of threads rendering rows (0 for one per hardware thread)
+     *
+     * Output is identical for every thread count. Tables with fewer than two
+     * blocks of rows are always rendered on the calling thread.
+     */
+    unsigned threads = 1;
+
+    /**
+     * @brief Number of data rows rendered by one thread at a time
+     *
+     * At most twice @c threads rendered blocks are held in memory; they are
+     * written out in order while later blocks are still being rendered.
+     */
+    size_t rowsPerBlock = 8192;
+
+    /**
+     * @brief Border to draw instead of the table's own border
+     *
+     * Lets a caller render a table in another style (e.g. Markdown) without
+     * copying and restyling it.
+     */
+    std::optional<Border> border{};
+
+    /**
+     * @brief Index of the first data row to render
+     *
+     * Together with rowLimit this renders one page of a large table. Pages
+     * use the column widths of the whole table, so consecutive pages line up,
+     * and the header is repeated on every page. Rendering a page costs time
+     * proportional to the page, not to the table.
+     */
+    size_t rowOffset = 0;
+
+    /**
+     * @brief Maximum number of data rows to render (all remaining rows if unset)
+     */
+    std::optional<size_t> rowLimit{};
+
+    /**
+     * @brief Index of the first column to render
+     */
+    size_t columnOffset = 0;
+
+    /**
+     * @brief Maximum number of columns to render (all remaining columns if unset)
+     */
+    std::optional<size_t> columnLimit{};
+
+    /**
+     * @brief Size columns from the header and this many leading data rows only
+     *
+     * Unset means exact widths over every row. A sample bounds the work done
+     * before the first row is written, at the price of narrower columns when
+     * later rows are wider: those lines are handled according to overflow.
+     * Widths set with setColumnWidth still take precedence.
+     */
+    std::optional<size_t> sampleRows{};
+
+    /**
+     * @brief Handling of cell lines wider than their column
+     */
+    Overflow overflow = Overflow::TRUNCATE;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_RENDER_OPTIONS_HPP
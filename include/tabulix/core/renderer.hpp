@@ -0,0 +1,161 @@
+/**
+ * @file renderer.hpp
+ * @brief Definition of the Renderer class shared by all table storages
+ */
+
+#ifndef TABULIX_CORE_RENDERER_HPP
+#define TABULIX_CORE_RENDERER_HPP
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "render_options.hpp"
+#include "sink.hpp"
+#include "width.hpp"
+#include "../styling/alignment.hpp"
+#include "../styling/border.hpp"
+
+namespace tabulix {
+
+/**
+ * @struct CellView
+ * @brief Non-owning view of a cell handed to the renderer
+ */
+struct CellView {
+    std::string_view text{};              ///< Cell content
+    std::optional<Alignment> alignment{}; ///< Cell alignment override
+};
+
+/**
+ * @class Renderer
+ * @brief Writes borders and rows of a table with fixed column widths
+ *
+ * The renderer does not own any table data: callers provide each row as a
+ * span of cell views, so any storage layout can be rendered with the same
+ * output. The border, widths and alignments must outlive the renderer.
+ *
+ * The top, separator and bottom lines only depend on the border and the
+ * column widths, so they are built once when the renderer is constructed
+ * and copied into the output as a whole. Every content line is exactly as
+ * wide as the column widths dictate, so the size of the output can be
+ * computed before rendering. A renderer keeps per-row scratch state and
+ * must not be shared between threads.
+ */
+class Renderer {
+public:
+    /**
+     * @brief Constructor
+     * @param border Border style to draw
+     * @param columnWidths Width of every column in terminal columns
+     * @param columnAlignments Default alignment per column (missing entries are left-aligned)
+     * @param overflow Handling of cell lines wider than their column
+     */
+    Renderer(const Border& border,
+             std::span<const size_t> columnWidths,
+             std::span<const Alignment> columnAlignments,
+             Overflow overflow = Overflow::TRUNCATE);
+
+    /**
+     * @brief Write the top border line
+     * @param out Destination writer
+     */
+    void writeTop(BufferedWriter& out) const;
+
+    /**
+     * @brief Write the separator between the header and the data rows
+     * @param out Destination writer
+     */
+    void writeHeaderSeparator(BufferedWriter& out) const;
+
+    /**
+     * @brief Write the separator between two data rows
+     * @param out Destination writer
+     */
+    void writeRowSeparator(BufferedWriter& out) const;
+
+    /**
+     * @brief Write the bottom border line
+     * @param out Destination writer
+     */
+    void writeBottom(BufferedWriter& out) const;
+
+    /**
+     * @brief Write a (possibly multiline) row
+     * @param out Destination writer
+     * @param cells Cells of the row; missing trailing cells render empty
+     */
+    void writeRow(BufferedWriter& out, std::span<const CellView> cells) const;
+
+    /**
+     * @brief Get the number of bytes writeRow produces for a row
+     * @param cells Cells of the row
+     * @return Size of the rendered row in bytes
+     */
+    [[nodiscard]] size_t rowSize(std::span<const CellView> cells) const noexcept;
+
+    /**
+     * @brief Get the number of bytes of all border and separator lines of a table
+     * @param hasHeader Whether the table has a header row
+     * @param rows Number of data rows
+     * @return Size of the top, separator and bottom lines in bytes
+     */
+    [[nodiscard]] size_t bordersSize(bool hasHeader, size_t rows) const noexcept;
+
+private:
+    const Border& m_border;
+    std::span<const size_t> m_columnWidths;
+    std::span<const Alignment> m_columnAlignments;
+    Overflow m_overflow;
+    size_t m_lineSize;
+    std::string m_topLine;
+    std::string m_separatorLine;
+    std::string m_bottomLine;
+
+    // Unconsumed text of every cell while a multiline row is written
+    mutable std::vector<std::string_view> m_remaining;
+
+    /**
+     * @brief Get the number of lines a row occupies
+     * @param cells Cells of the row
+     * @return Maximum line count among the cells (at least 1)
+     */
+    [[nodiscard]] size_t rowLines(std::span<const CellView> cells) const noexcept;
+
+    /**
+     * @brief Take the next rendered line of a cell
+     *
+     * Returns the next line truncated to the column width, or with WRAP the
+     * part of it that fits, leaving the rest for the following line.
+     *
+     * @param text Unconsumed cell text, advanced past the returned part
+     * @param width Column width
+     * @return The text to write and its display width
+     */
+    [[nodiscard]] FittedText nextSegment(std::string_view& text, size_t width) const noexcept;
+
+    /**
+     * @brief Build a horizontal border line for the current column widths
+     * @param left Left edge string
+     * @param intersection Column intersection string
+     * @param right Right edge string
+     * @return The complete line including its newline, or an empty string without borders
+     */
+    [[nodiscard]] std::string buildLine(std::string_view left,
+                                        std::string_view intersection,
+                                        std::string_view right) const;
+
+    /**
+     * @brief Write a line of cell text padded according to alignment
+     * @param out Destination writer
+     * @param text Text to write, already fitted to the column
+     * @param width Column width
+     * @param align Alignment to apply
+     */
+    static void writePadded(BufferedWriter& out, const FittedText& text, size_t width, Alignment align);
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_RENDERER_HPP
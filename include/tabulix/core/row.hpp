@@ -8,6 +8,10 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
+#include <span>
+#include <concepts>
+#include <memory_resource>
 #include "cell.hpp"
 
 namespace tabulix {
@@ -15,32 +19,80 @@ namespace tabulix {
 /**
  * @class Row
  * @brief Represents a row in a table
+ *
+ * The row and all of its cells allocate from the same memory resource.
  */
 class Row {
 public:
+    /**
+     * @brief Allocator used for the row and its cells
+     */
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     /**
      * @brief Default constructor
      */
     Row() = default;
 
+    /**
+     * @brief Constructor with allocator
+     * @param alloc Allocator for the row and its cells
+     */
+    explicit Row(const allocator_type& alloc) noexcept;
+
     /**
      * @brief Constructor with cells
      * @param cells Vector of cell values
+     * @param alloc Allocator for the row and its cells
      */
-    explicit Row(const std::vector<std::string>& cells);
+    explicit Row(const std::vector<std::string>& cells, const allocator_type& alloc = {});
 
     /**
      * @brief Constructor with cells
      * @param cells Initializer list of cell values
+     * @param alloc Allocator for the row and its cells
+     */
+    Row(std::initializer_list<std::string> cells, const allocator_type& alloc = {});
+
+    /**
+     * @brief Copy constructor
+     */
+    Row(const Row&) = default;
+
+    /**
+     * @brief Move constructor
+     */
+    Row(Row&&) noexcept = default;
+
+    /**
+     * @brief Allocator-extended copy constructor
+     * @param other Row to copy
+     * @param alloc Allocator for the row and its cells
+     */
+    Row(const Row& other, const allocator_type& alloc);
+
+    /**
+     * @brief Allocator-extended move constructor
+     * @param other Row to move from
+     * @param alloc Allocator for the row and its cells
+     */
+    Row(Row&& other, const allocator_type& alloc);
+
+    Row& operator=(const Row&) = default;
+    Row& operator=(Row&&) = default;
+
+    /**
+     * @brief Get the allocator used for the row and its cells
+     * @return Row allocator
      */
-    Row(std::initializer_list<std::string> cells);
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
 
     /**
      * @brief Add a cell to the row
      * @param value Cell value
      * @return Reference to this row for method chaining
      */
-    Row& addCell(const std::string& value);
+    Row& addCell(std::string_view value);
 
     /**
      * @brief Add a cell to the row
@@ -49,6 +101,41 @@ public:
      */
     Row& addCell(const Cell& cell);
 
+    /**
+     * @brief Add a cell to the row, moving from it
+     * @param cell Cell object
+     * @return Reference to this row for method chaining
+     */
+    Row& addCell(Cell&& cell);
+
+    /**
+     * @brief Add a cell taking over a string's buffer
+     *
+     * The buffer is adopted without copying when @p value uses the row's
+     * memory resource; otherwise it is copied once.
+     *
+     * @param value Cell value to move from
+     * @return Reference to this row for method chaining
+     */
+    template <typename String>
+    requires std::same_as<String, std::pmr::string>
+    Row& addCell(String&& value);
+
+    /**
+     * @brief Add a numeric cell to the row
+     * @param value Cell value, formatted when the table is rendered or exported
+     * @return Reference to this row for method chaining
+     */
+    template <CellNumber T>
+    Row& addCell(T value);
+
+    /**
+     * @brief Reserve room for a number of cells
+     * @param cells Number of cells the row will hold
+     * @return Reference to this row for method chaining
+     */
+    Row& reserve(size_t cells);
+
     /**
      * @brief Get the number of cells in the row
      * @return Number of cells
@@ -89,14 +176,28 @@ public:
 
     /**
      * @brief Get all cells in the row
-     * @return Vector of cells
+     * @return View of the cells
      */
-    [[nodiscard]] const std::vector<Cell>& cells() const noexcept;
+    [[nodiscard]] std::span<const Cell> cells() const noexcept;
 
 private:
-    std::vector<Cell> m_cells;
+    std::pmr::vector<Cell> m_cells;
 };
 
+// Template implementation
+template <typename String>
+requires std::same_as<String, std::pmr::string>
+Row& Row::addCell(String&& value) {
+    m_cells.emplace_back(std::move(value));
+    return *this;
+}
+
+template <CellNumber T>
+Row& Row::addCell(T value) {
+    m_cells.emplace_back(value);
+    return *this;
+}
+
 } // namespace tabulix
 
 #endif // TABULIX_CORE_ROW_HPP
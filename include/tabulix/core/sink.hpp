@@ -0,0 +1,252 @@
+/**
+ * @file sink.hpp
+ * @brief Definition of output sinks and the chunked writer used for rendering
+ */
+
+#ifndef TABULIX_CORE_SINK_HPP
+#define TABULIX_CORE_SINK_HPP
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace tabulix {
+
+/**
+ * @class OutputSink
+ * @brief Abstract destination for rendered output
+ *
+ * Sinks receive rendered output in chunks, so a table can be written
+ * without materializing the whole result in memory first.
+ */
+class OutputSink {
+public:
+    /**
+     * @brief Virtual destructor
+     */
+    virtual ~OutputSink() = default;
+
+    /**
+     * @brief Write a chunk of data to the sink
+     * @param data Data to write
+     */
+    virtual void write(std::string_view data) = 0;
+
+    /**
+     * @brief Flush any data buffered by the underlying destination
+     */
+    virtual void flush() {}
+
+    /**
+     * @brief Get the chunk size writers should batch output into for this sink
+     * @return Preferred chunk size in bytes
+     */
+    [[nodiscard]] virtual size_t preferredChunkSize() const noexcept;
+};
+
+/**
+ * @class StringSink
+ * @brief Sink that appends output to a string
+ */
+class StringSink : public OutputSink {
+public:
+    /**
+     * @brief Constructor
+     * @param target String to append output to
+     */
+    explicit StringSink(std::string& target) noexcept;
+
+    void write(std::string_view data) override;
+
+private:
+    std::string& m_target;
+};
+
+/**
+ * @class StreamSink
+ * @brief Sink that writes output to a std::ostream
+ */
+class StreamSink : public OutputSink {
+public:
+    /**
+     * @brief Constructor
+     * @param stream Stream to write output to
+     */
+    explicit StreamSink(std::ostream& stream) noexcept;
+
+    void write(std::string_view data) override;
+    void flush() override;
+
+private:
+    std::ostream& m_stream;
+};
+
+/**
+ * @class FileDescriptorSink
+ * @brief Sink that writes output to a POSIX file descriptor
+ */
+class FileDescriptorSink : public OutputSink {
+public:
+    /**
+     * @brief Constructor
+     * @param fd Open file descriptor; ownership is not transferred
+     */
+    explicit FileDescriptorSink(int fd) noexcept;
+
+    /**
+     * @brief Chunk size of writers over a file descriptor
+     *
+     * Every chunk costs a system call, so files are written in larger
+     * chunks than in-memory sinks.
+     */
+    static constexpr size_t kChunkSize = 1024 * 1024;
+
+    /**
+     * @brief Write a chunk of data to the file descriptor
+     * @param data Data to write
+     * @throws std::system_error if the underlying write fails
+     */
+    void write(std::string_view data) override;
+
+    [[nodiscard]] size_t preferredChunkSize() const noexcept override;
+
+    /**
+     * @brief Get the number of bytes the file descriptor has accepted
+     *
+     * Includes the part of a chunk written before a write failed, so after
+     * an error it still matches what reached the file.
+     *
+     * @return Number of bytes written through this sink
+     */
+    [[nodiscard]] size_t bytesWritten() const noexcept;
+
+private:
+    int m_fd;
+    size_t m_bytesWritten = 0;
+};
+
+/**
+ * @class CallbackSink
+ * @brief Sink that forwards each chunk to a user callback
+ */
+class CallbackSink : public OutputSink {
+public:
+    /**
+     * @brief Callback invoked for every chunk of output
+     */
+    using Callback = std::function<void(std::string_view)>;
+
+    /**
+     * @brief Constructor
+     * @param callback Callback receiving output chunks
+     */
+    explicit CallbackSink(Callback callback);
+
+    void write(std::string_view data) override;
+
+private:
+    Callback m_callback;
+};
+
+/**
+ * @class BufferedWriter
+ * @brief Accumulates output in a fixed-size buffer and hands it to a sink in chunks
+ *
+ * Peak memory is bounded by the buffer capacity regardless of how much is
+ * written through the writer. A writer constructed over a string instead
+ * appends straight into it, which avoids the intermediate copy when the
+ * whole output is wanted in memory anyway.
+ */
+class BufferedWriter {
+public:
+    /**
+     * @brief Default buffer capacity in bytes
+     */
+    static constexpr size_t kDefaultCapacity = 64 * 1024;
+
+    /**
+     * @brief Constructor using the sink's preferred chunk size
+     * @param sink Destination for the buffered output
+     */
+    explicit BufferedWriter(OutputSink& sink);
+
+    /**
+     * @brief Constructor
+     * @param sink Destination for the buffered output
+     * @param capacity Buffer capacity in bytes
+     */
+    BufferedWriter(OutputSink& sink, size_t capacity);
+
+    /**
+     * @brief Constructor writing directly into a string without chunking
+     * @param target String to append output to
+     */
+    explicit BufferedWriter(std::string& target) noexcept;
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    /**
+     * @brief Append data to the buffer, flushing to the sink when it fills up
+     * @param data Data to append
+     */
+    void write(std::string_view data);
+
+    /**
+     * @brief Append a character repeated a number of times
+     * @param count Number of repetitions
+     * @param c Character to append
+     */
+    void write(size_t count, char c);
+
+    /**
+     * @brief Hand all buffered data to the sink
+     */
+    void flush();
+
+    /**
+     * @brief Check whether the writer appends directly into a string
+     * @return true if the writer was constructed over a string
+     */
+    [[nodiscard]] bool direct() const noexcept;
+
+    /**
+     * @brief Reserve room for upcoming output in a direct writer's string
+     * @param size Number of bytes about to be written
+     */
+    void reserve(size_t size);
+
+private:
+    OutputSink* m_sink;
+    std::string m_ownBuffer;
+    std::string* m_buffer;
+    size_t m_capacity;
+};
+
+// Inline implementation
+inline void BufferedWriter::write(std::string_view data) {
+    if (m_buffer->size() + data.size() > m_capacity) {
+        flush();
+        if (data.size() > m_capacity) {
+            m_sink->write(data);
+            return;
+        }
+    }
+    m_buffer->append(data);
+}
+
+inline void BufferedWriter::write(size_t count, char c) {
+    while (m_buffer->size() + count > m_capacity) {
+        const size_t chunk = m_capacity - m_buffer->size();
+        m_buffer->append(chunk, c);
+        count -= chunk;
+        flush();
+    }
+    m_buffer->append(count, c);
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_SINK_HPP
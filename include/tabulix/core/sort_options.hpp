@@ -0,0 +1,60 @@
+/**
+ * @file sort_options.hpp
+ * @brief Definition of the SortOptions structure
+ */
+
+#ifndef TABULIX_CORE_SORT_OPTIONS_HPP
+#define TABULIX_CORE_SORT_OPTIONS_HPP
+
+#include <cstddef>
+
+namespace tabulix {
+
+/**
+ * @enum SortKey
+ * @brief How the cells of the sort column are compared
+ */
+enum class SortKey {
+    LEXICOGRAPHIC, ///< Byte-wise comparison of the cell text (numbers in their column format)
+    NUMERIC        ///< Comparison of numeric cells and of text cells that parse as numbers
+};
+
+/**
+ * @struct SortOptions
+ * @brief Per-call settings for sorting the rows of a table
+ */
+struct SortOptions {
+    /**
+     * @brief How cells are compared (ignored when a comparator is given)
+     */
+    SortKey key = SortKey::LEXICOGRAPHIC;
+
+    /**
+     * @brief Sort from the largest to the smallest value
+     *
+     * Rows without a value in the sort column (and, for NUMERIC keys, rows
+     * whose cell is not a number) come last in either direction.
+     */
+    bool descending = false;
+
+    /**
+     * @brief Keep rows with equal values in their current order
+     */
+    bool stable = true;
+
+    /**
+     * @brief Number of threads sorting (0 for one per hardware thread)
+     *
+     * The result is the same for every thread count when sorting stably.
+     */
+    unsigned threads = 1;
+
+    /**
+     * @brief Tables with fewer data rows are always sorted on the calling thread
+     */
+    size_t minParallelRows = 32768;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_SORT_OPTIONS_HPP
@@ -8,13 +8,24 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <optional>
+#include <span>
+#include <algorithm>
 #include <concepts>
+#include <type_traits>
 #include <format>
 #include <ranges>
+#include <memory_resource>
+#include <numeric>
+#include <stdexcept>
 
 #include "row.hpp"
+#include "parallel.hpp"
+#include "render_options.hpp"
+#include "sink.hpp"
+#include "sort_options.hpp"
 #include "../styling/theme.hpp"
 #include "../styling/border.hpp"
 #include "../styling/alignment.hpp"
@@ -24,25 +35,48 @@ namespace tabulix {
 /**
  * @class Table
  * @brief Main class for creating and formatting tables
+ *
+ * All rows and cell contents are allocated from the table's memory
+ * resource. Passing a std::pmr::monotonic_buffer_resource lets a whole
+ * report be built and released with a few large allocations.
  */
 class Table {
 public:
+    /**
+     * @brief Allocator used for rows and cell contents
+     */
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     /**
      * @brief Default constructor
      */
     Table() = default;
 
+    /**
+     * @brief Constructor with allocator
+     * @param alloc Allocator for rows and cell contents
+     */
+    explicit Table(const allocator_type& alloc) noexcept;
+
     /**
      * @brief Constructor with headers
      * @param headers Vector of header strings
+     * @param alloc Allocator for rows and cell contents
      */
-    explicit Table(const std::vector<std::string>& headers);
+    explicit Table(const std::vector<std::string>& headers, const allocator_type& alloc = {});
 
     /**
      * @brief Constructor with headers
      * @param headers Initializer list of header strings
+     * @param alloc Allocator for rows and cell contents
      */
-    Table(std::initializer_list<std::string> headers);
+    Table(std::initializer_list<std::string> headers, const allocator_type& alloc = {});
+
+    /**
+     * @brief Get the allocator used for rows and cell contents
+     * @return Table allocator
+     */
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
 
     /**
      * @brief Add a header row to the table
@@ -64,7 +98,7 @@ public:
      * @return Reference to this table for method chaining
      */
     template <typename T>
-    requires std::convertible_to<T, std::string>
+    requires std::convertible_to<T, std::string> || CellNumber<T>
     Table& addRow(const std::vector<T>& cells);
 
     /**
@@ -73,7 +107,7 @@ public:
      * @return Reference to this table for method chaining
      */
     template <typename T>
-    requires std::convertible_to<T, std::string>
+    requires std::convertible_to<T, std::string> || CellNumber<T>
     Table& addRow(std::initializer_list<T> cells);
 
     /**
@@ -83,6 +117,96 @@ public:
      */
     Table& addRow(const Row& row);
 
+    /**
+     * @brief Add a pre-constructed Row to the table, moving from it
+     *
+     * The row's cells are adopted without copying when the row uses the
+     * table's memory resource; otherwise they are copied once.
+     *
+     * @param row Row object to add
+     * @return Reference to this table for method chaining
+     */
+    Table& addRow(Row&& row);
+
+    /**
+     * @brief Construct a row in place from individual cell values
+     *
+     * Each argument becomes one cell. Rvalue std::pmr::string and Cell
+     * arguments are moved into the table, numbers are stored unformatted,
+     * and anything else convertible to std::string_view is copied once.
+     *
+     * @param cells Cell values
+     * @return Reference to this table for method chaining
+     */
+    template <typename... Cells>
+    requires (... && (std::convertible_to<Cells, std::string_view> || std::same_as<std::remove_cvref_t<Cells>, Cell>
+                   || CellNumber<std::remove_cvref_t<Cells>>))
+    Table& emplaceRow(Cells&&... cells);
+
+    /**
+     * @brief Reserve room for a number of data rows
+     *
+     * Adding up to @p rows rows afterwards never reallocates the row storage.
+     *
+     * @param rows Number of data rows the table will hold
+     * @return Reference to this table for method chaining
+     */
+    Table& reserveRows(size_t rows);
+
+    /**
+     * @brief Reserve room for a number of cells in every row added afterwards
+     * @param columns Number of columns rows will hold
+     * @return Reference to this table for method chaining
+     */
+    Table& reserveColumns(size_t columns);
+
+    /**
+     * @brief Replace the content of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @param value New cell content
+     * @return Reference to this table for method chaining
+     * @throws std::out_of_range if the row or column does not exist
+     */
+    Table& setValue(size_t rowIndex, size_t columnIndex, std::string_view value);
+
+    /**
+     * @brief Sort the data rows by the cells of a column
+     *
+     * One compact key is computed per row before sorting: for NUMERIC keys the
+     * number as an order-preserving 64-bit integer, followed by its exact
+     * integer value so large int64_t values keep their order, and the first
+     * sixteen bytes of the text for LEXICOGRAPHIC keys,
+     * where only ties between longer texts look at the cells again. The keys
+     * are sorted together with their row indices, on several threads for
+     * large tables, and every row is then moved once into its place. The
+     * header is not sorted and column widths are unchanged.
+     *
+     * @param columnIndex Index of the column (0-based)
+     * @param options Key, direction, stability and threads
+     * @return Reference to this table for method chaining
+     * @throws std::out_of_range if the column does not exist
+     */
+    Table& sortBy(size_t columnIndex, const SortOptions& options = {});
+
+    /**
+     * @brief Sort the data rows by the cells of a column with a comparator
+     *
+     * Row indices are sorted rather than rows, so the comparator is the only
+     * per-comparison cost; rows are then moved once into their place. Rows
+     * without a cell in the column come last.
+     *
+     * @param columnIndex Index of the column (0-based)
+     * @param compare Strict weak ordering of two cells; called from several threads
+     *                when sorting in parallel
+     * @param options Direction, stability and threads (the key is ignored)
+     * @return Reference to this table for method chaining
+     * @throws std::out_of_range if the column does not exist
+     */
+    template <typename Compare>
+    requires std::predicate<Compare&, const Cell&, const Cell&>
+    Table& sortBy(size_t columnIndex, Compare compare, const SortOptions& options = {});
+
     /**
      * @brief Set the theme for the table
      * @param theme Theme to apply
@@ -105,6 +229,15 @@ public:
      */
     Table& setColumnAlignment(size_t columnIndex, Alignment alignment);
 
+    /**
+     * @brief Set how numeric cells of a column are formatted
+     * @param columnIndex Index of the column (0-based)
+     * @param spec Format specification, e.g. ".2f" (see FormatSpec)
+     * @return Reference to this table for method chaining
+     * @throws std::invalid_argument if the specification is not supported
+     */
+    Table& setColumnFormat(size_t columnIndex, std::string_view spec);
+
     /**
      * @brief Set the width for a specific column
      * @param columnIndex Index of the column (0-based)
@@ -125,6 +258,57 @@ public:
      */
     [[nodiscard]] size_t columnCount() const noexcept;
 
+    /**
+     * @brief Get the border the table is drawn with
+     * @return Border of the current theme, or the custom border
+     */
+    [[nodiscard]] const Border& border() const noexcept;
+
+    /**
+     * @brief Get the theme of the table
+     * @return Theme last set with setTheme (GRID by default), even if a custom border was set since
+     */
+    [[nodiscard]] Theme theme() const noexcept;
+
+    /**
+     * @brief Get the header row
+     * @return The header row, or std::nullopt if the table has none
+     */
+    [[nodiscard]] const std::optional<Row>& header() const noexcept;
+
+    /**
+     * @brief Get the data rows (header excluded)
+     * @return View of the data rows in insertion order
+     */
+    [[nodiscard]] std::span<const Row> rows() const noexcept;
+
+    /**
+     * @brief Get the default alignment of a column
+     * @param columnIndex Index of the column (0-based)
+     * @return Alignment of the column (LEFT if none was set)
+     */
+    [[nodiscard]] Alignment columnAlignment(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the format of numeric cells in a column
+     * @param columnIndex Index of the column (0-based)
+     * @return Format of the column (the default format if none was set)
+     */
+    [[nodiscard]] const FormatSpec& columnFormat(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the width set for a column with setColumnWidth
+     * @param columnIndex Index of the column (0-based)
+     * @return Fixed width of the column, or std::nullopt if it is auto-sized
+     */
+    [[nodiscard]] std::optional<size_t> fixedColumnWidth(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the column widths used when rendering the table
+     * @return Vector of column widths in characters
+     */
+    [[nodiscard]] std::vector<size_t> columnWidths() const;
+
     /**
      * @brief Check if the table is empty (has no rows)
      * @return true if empty, false otherwise
@@ -139,9 +323,17 @@ public:
 
     /**
      * @brief Get a string representation of the table
+     * @param options Rendering options (e.g. number of threads)
      * @return Formatted table as string
      */
-    [[nodiscard]] std::string str() const;
+    [[nodiscard]] std::string str(const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Render the table into an output sink in bounded chunks
+     * @param sink Destination for the rendered table
+     * @param options Rendering options (e.g. number of threads)
+     */
+    void renderTo(OutputSink& sink, const RenderOptions& options = {}) const;
 
     /**
      * @brief Output stream operator overload
@@ -153,58 +345,130 @@ public:
 
 private:
     std::optional<Row> m_header;
-    std::vector<Row> m_rows;
+    std::pmr::vector<Row> m_rows;
     Theme m_theme = Theme::GRID;
     Border m_border = getBorderForTheme(m_theme);
     std::vector<Alignment> m_columnAlignments;
     std::vector<std::optional<size_t>> m_columnWidths;
+    std::vector<FormatSpec> m_columnFormats;
+
+    // Content widths are maintained as cells are added, so rendering never rescans the rows
+    std::vector<size_t> m_headerWidths;
+    std::vector<size_t> m_rowWidths;
+
+    // Cell capacity of rows created by the table (see reserveColumns)
+    size_t m_reservedColumns = 0;
 
     /**
      * @brief Calculate the column widths based on content
+     * @param sampleRows Only measure the header and this many leading rows (all rows if unset)
      * @return Vector of column widths
      */
-    [[nodiscard]] std::vector<size_t> calculateColumnWidths() const;
+    [[nodiscard]] std::vector<size_t> calculateColumnWidths(std::optional<size_t> sampleRows = std::nullopt) const;
 
     /**
-     * @brief Render the table to a string
-     * @return Formatted table string
+     * @brief Initialize per-column settings and widths after a row has been added
+     * @param row The row that was added
      */
-    [[nodiscard]] std::string render() const;
+    void onRowAdded(const Row& row);
 
     /**
-     * @brief Split text by newline characters for multiline support
-     * @param text Text to split
-     * @return Vector of lines
+     * @brief Recompute the widest data cell of one column from scratch
+     * @param columnIndex Index of the column (0-based)
      */
-    [[nodiscard]] std::vector<std::string> splitLines(const std::string& text) const;
+    void remeasureColumn(size_t columnIndex);
 
     /**
-     * @brief Get the maximum line width in a multiline text
-     * @param text Text to analyze
-     * @return Maximum width among all lines
+     * @brief Reorder the data rows, moving each row once
+     * @param order Index of the row that goes to every position; consumed
      */
-    [[nodiscard]] size_t getMaxLineWidth(const std::string& text) const;
+    void permuteRows(std::vector<size_t>& order);
+
+    /**
+     * @brief Append a row built directly in table storage
+     * @param cells Range of cell values
+     * @return Reference to this table for method chaining
+     */
+    template <typename Range>
+    Table& appendRow(const Range& cells);
+
+    /**
+     * @brief Render the table into a buffered writer
+     *
+     * With several threads, blocks of data rows are rendered concurrently
+     * into per-thread buffers and written out in order.
+     *
+     * @param out Writer receiving the formatted table
+     * @param options Rendering options
+     */
+    void render(BufferedWriter& out, const RenderOptions& options) const;
 };
 
 // Template implementation
-template <typename T>
-requires std::convertible_to<T, std::string>
-Table& Table::addRow(const std::vector<T>& cells) {
-    Row row;
+template <typename Range>
+Table& Table::appendRow(const Range& cells) {
+    // Build the row in place so its cells are allocated only once, from the table's resource
+    Row& row = m_rows.emplace_back();
+    row.reserve(std::max(m_reservedColumns, std::ranges::size(cells)));
     for (const auto& cell : cells) {
-        row.addCell(std::string(cell));
+        if constexpr (CellNumber<std::remove_cvref_t<decltype(cell)>>) {
+            row.addCell(cell);
+        } else if constexpr (std::convertible_to<decltype(cell), std::string_view>) {
+            row.addCell(std::string_view(cell));
+        } else {
+            row.addCell(std::string(cell));
+        }
     }
-    return addRow(row);
+    onRowAdded(row);
+    return *this;
+}
+
+template <typename... Cells>
+requires (... && (std::convertible_to<Cells, std::string_view> || std::same_as<std::remove_cvref_t<Cells>, Cell>
+                   || CellNumber<std::remove_cvref_t<Cells>>))
+Table& Table::emplaceRow(Cells&&... cells) {
+    Row& row = m_rows.emplace_back();
+    row.reserve(std::max(m_reservedColumns, sizeof...(Cells)));
+    (row.addCell(std::forward<Cells>(cells)), ...);
+    onRowAdded(row);
+    return *this;
+}
+
+template <typename Compare>
+requires std::predicate<Compare&, const Cell&, const Cell&>
+Table& Table::sortBy(size_t columnIndex, Compare compare, const SortOptions& options) {
+    if (columnIndex >= columnCount()) {
+        throw std::out_of_range("Column index out of range");
+    }
+
+    std::vector<size_t> order(m_rows.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    auto less = [&](size_t a, size_t b) {
+        const bool hasA = columnIndex < m_rows[a].size();
+        const bool hasB = columnIndex < m_rows[b].size();
+        if (!hasA || !hasB) {
+            return hasA && !hasB;
+        }
+        const Cell& cellA = m_rows[a].at(columnIndex);
+        const Cell& cellB = m_rows[b].at(columnIndex);
+        return options.descending ? compare(cellB, cellA) : compare(cellA, cellB);
+    };
+    const unsigned threads = m_rows.size() >= options.minParallelRows ? options.threads : 1;
+    parallelSort(order.begin(), order.end(), less, threads, options.stable);
+    permuteRows(order);
+    return *this;
 }
 
 template <typename T>
-requires std::convertible_to<T, std::string>
+requires std::convertible_to<T, std::string> || CellNumber<T>
+Table& Table::addRow(const std::vector<T>& cells) {
+    return appendRow(cells);
+}
+
+template <typename T>
+requires std::convertible_to<T, std::string> || CellNumber<T>
 Table& Table::addRow(std::initializer_list<T> cells) {
-    Row row;
-    for (const auto& cell : cells) {
-        row.addCell(std::string(cell));
-    }
-    return addRow(row);
+    return appendRow(cells);
 }
 
 } // namespace tabulix
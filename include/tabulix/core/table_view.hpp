@@ -0,0 +1,404 @@
+/**
+ * @file table_view.hpp
+ * @brief Definition of the TableView class template
+ */
+
+#ifndef TABULIX_CORE_TABLE_VIEW_HPP
+#define TABULIX_CORE_TABLE_VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cell.hpp"
+#include "format.hpp"
+#include "render_options.hpp"
+#include "renderer.hpp"
+#include "sink.hpp"
+#include "text.hpp"
+#include "../styling/alignment.hpp"
+#include "../styling/border.hpp"
+#include "../styling/theme.hpp"
+
+namespace tabulix {
+
+/**
+ * @struct ViewColumn
+ * @brief A column of a TableView: a header and how to get the value from an element
+ * @tparam Projection Callable (or member pointer) invoked with each element
+ */
+template <typename Projection>
+struct ViewColumn {
+    std::string_view header;             ///< Header text
+    Projection projection;               ///< Produces the cell value of an element
+    Alignment alignment = Alignment::LEFT; ///< Column alignment
+    FormatSpec format{};                 ///< Format of numeric values
+};
+
+/**
+ * @brief Create a TableView column
+ * @param header Header text; must outlive the view
+ * @param projection Callable or member pointer producing a string-like or numeric value
+ * @param alignment Column alignment
+ * @param format Format spec of numeric values (see FormatSpec)
+ * @return The column description
+ * @throws std::invalid_argument if the format spec is not supported
+ */
+template <typename Projection>
+[[nodiscard]] ViewColumn<Projection> column(std::string_view header, Projection projection,
+                                            Alignment alignment = Alignment::LEFT, std::string_view format = {}) {
+    return {header, std::move(projection), alignment, FormatSpec::parse(format)};
+}
+
+/**
+ * @class TableView
+ * @brief Renders caller-owned data as a table without copying it
+ *
+ * A view pairs a range of elements with one projection per column. Values
+ * are pulled from the elements while rendering: string-like values are
+ * referenced in place and numbers are formatted into per-column scratch
+ * buffers, so the only memory the view needs is the output buffer.
+ *
+ * A container passed as an lvalue is referenced and must outlive the view;
+ * an rvalue (a temporary container or a view such as std::views::filter)
+ * is moved into the view. The elements must not change while the view is
+ * rendered, and since rendering iterates the stored range, which views
+ * like std::views::filter update as they cache, a view must not be
+ * rendered from several threads at once.
+ *
+ * @code
+ * struct Person { std::string name; int age; };
+ * std::vector<Person> people = ...;
+ * tabulix::TableView view(people, tabulix::column("Name", &Person::name),
+ *                         tabulix::column("Age", &Person::age, tabulix::Alignment::RIGHT));
+ * std::cout << view;
+ * @endcode
+ *
+ * @tparam Range Forward view of the elements (std::views::all_t of the range passed in)
+ * @tparam Projections Projection type of every column
+ */
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+class TableView {
+public:
+    /**
+     * @brief Constructor
+     * @param range Elements to display, one per row
+     * @param columns Column descriptions (see column())
+     */
+    template <std::ranges::viewable_range R>
+    requires std::constructible_from<Range, std::views::all_t<R>>
+    explicit TableView(R&& range, ViewColumn<Projections>... columns);
+
+    /**
+     * @brief Set the theme for the view
+     * @param theme Theme to apply
+     * @return Reference to this view for method chaining
+     */
+    TableView& setTheme(Theme theme);
+
+    /**
+     * @brief Set custom border style
+     * @param border Border style to apply
+     * @return Reference to this view for method chaining
+     */
+    TableView& setBorder(const Border& border);
+
+    /**
+     * @brief Get the number of data rows
+     * @return Number of elements in the range
+     */
+    [[nodiscard]] size_t rowCount() const;
+
+    /**
+     * @brief Get the number of columns
+     * @return Number of columns
+     */
+    [[nodiscard]] static constexpr size_t columnCount() noexcept;
+
+    /**
+     * @brief Get the column widths used when rendering the view
+     *
+     * Widths are not cached: the underlying data may change between renders.
+     *
+     * @return Vector of column widths in terminal columns
+     */
+    [[nodiscard]] std::vector<size_t> columnWidths() const;
+
+    /**
+     * @brief Get a string representation of the view
+     * @param options Rendering options (border, sampleRows and overflow are honored; rows render on one thread)
+     * @return Formatted table as string
+     */
+    [[nodiscard]] std::string str(const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Render the view into an output sink in bounded chunks
+     * @param sink Destination for the rendered table
+     * @param options Rendering options (border, sampleRows and overflow are honored; rows render on one thread)
+     */
+    void renderTo(OutputSink& sink, const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Output stream operator overload
+     * @param os Output stream
+     * @param view View to output
+     * @return Reference to the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const TableView& view) {
+        StreamSink sink(os);
+        view.renderTo(sink);
+        return os;
+    }
+
+private:
+    static constexpr size_t kColumns = sizeof...(Projections);
+
+    // Iterating a view may update its cache, even when rendering a const view
+    mutable Range m_range;
+    std::tuple<ViewColumn<Projections>...> m_columns;
+    Border m_border = getBorderForTheme(Theme::GRID);
+
+    /**
+     * @brief Turn a projected value into text without copying string data
+     * @param value Projected value
+     * @param buffer Scratch buffer for numbers and temporary strings
+     * @param format Format of numeric values
+     * @return View of the text, valid until @p buffer or the element changes
+     */
+    template <typename Value>
+    static std::string_view toText(Value&& value, std::string& buffer, const FormatSpec& format);
+
+    /**
+     * @brief Measure the columns over the header and the elements
+     * @param sampleRows Only measure this many leading elements (all if unset)
+     * @return Vector of column widths in terminal columns
+     */
+    [[nodiscard]] std::vector<size_t> calculateColumnWidths(std::optional<size_t> sampleRows) const;
+
+    /**
+     * @brief Fill the cell views of one element
+     * @param element Element of the range
+     * @param cells Views receiving the column texts
+     * @param buffers Per-column scratch buffers
+     */
+    template <typename Element>
+    void viewElement(const Element& element, std::array<CellView, kColumns>& cells,
+                     std::array<std::string, kColumns>& buffers) const;
+
+    /**
+     * @brief Fill the cell views of the header
+     * @param cells Views receiving the header texts
+     */
+    void viewHeader(std::array<CellView, kColumns>& cells) const;
+
+    /**
+     * @brief Render the view into a buffered writer
+     * @param out Writer receiving the formatted table
+     * @param options Rendering options
+     */
+    void render(BufferedWriter& out, const RenderOptions& options) const;
+};
+
+/**
+ * @brief Deduction guide for constructing a view from a range and columns
+ */
+template <std::ranges::viewable_range Range, typename... Projections>
+TableView(Range&&, ViewColumn<Projections>...) -> TableView<std::views::all_t<Range>, Projections...>;
+
+// Template implementation
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+template <std::ranges::viewable_range R>
+requires std::constructible_from<Range, std::views::all_t<R>>
+TableView<Range, Projections...>::TableView(R&& range, ViewColumn<Projections>... columns)
+    : m_range(std::views::all(std::forward<R>(range)))
+    , m_columns(std::move(columns)...) {
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+TableView<Range, Projections...>& TableView<Range, Projections...>::setTheme(Theme theme) {
+    m_border = getBorderForTheme(theme);
+    return *this;
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+TableView<Range, Projections...>& TableView<Range, Projections...>::setBorder(const Border& border) {
+    m_border = border;
+    return *this;
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+size_t TableView<Range, Projections...>::rowCount() const {
+    return static_cast<size_t>(std::ranges::distance(m_range));
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+constexpr size_t TableView<Range, Projections...>::columnCount() noexcept {
+    return kColumns;
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+template <typename Value>
+std::string_view TableView<Range, Projections...>::toText(Value&& value, std::string& buffer,
+                                                         const FormatSpec& format) {
+    using Plain = std::remove_cvref_t<Value>;
+    if constexpr (CellNumber<Plain>) {
+        if constexpr (std::floating_point<Plain>) {
+            return formatNumber(buffer, static_cast<double>(value), format);
+        } else {
+            return formatNumber(buffer, static_cast<int64_t>(value), format);
+        }
+    } else if constexpr (std::same_as<Plain, char>) {
+        // A character is text of its own, not the number of its code point
+        buffer.assign(1, value);
+        return buffer;
+    } else {
+        static_assert(std::convertible_to<Value, std::string_view>,
+                      "TableView projections must return a string-like, char or arithmetic value");
+        if constexpr (!std::is_lvalue_reference_v<Value> && !std::same_as<Plain, std::string_view> &&
+                      !std::is_pointer_v<Plain>) {
+            // A projection returning a string by value (std::string, std::pmr::string, or any
+            // other type owning its text): keep the text alive in the scratch buffer
+            if constexpr (std::same_as<Plain, std::string>) {
+                buffer = std::move(value);
+            } else {
+                buffer.assign(std::string_view(value));
+            }
+            return buffer;
+        } else {
+            return std::string_view(value);
+        }
+    }
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+template <typename Element>
+void TableView<Range, Projections...>::viewElement(const Element& element, std::array<CellView, kColumns>& cells,
+                                                   std::array<std::string, kColumns>& buffers) const {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((cells[I].text = toText(std::invoke(std::get<I>(m_columns).projection, element), buffers[I],
+                                 std::get<I>(m_columns).format)), ...);
+    }(std::make_index_sequence<kColumns>{});
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+void TableView<Range, Projections...>::viewHeader(std::array<CellView, kColumns>& cells) const {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((cells[I].text = std::get<I>(m_columns).header), ...);
+    }(std::make_index_sequence<kColumns>{});
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+std::vector<size_t> TableView<Range, Projections...>::columnWidths() const {
+    return calculateColumnWidths(std::nullopt);
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+std::vector<size_t> TableView<Range, Projections...>::calculateColumnWidths(std::optional<size_t> sampleRows) const {
+    std::vector<size_t> widths(kColumns, 0);
+    std::array<CellView, kColumns> cells{};
+    std::array<std::string, kColumns> buffers;
+
+    viewHeader(cells);
+    for (size_t i = 0; i < kColumns; ++i) {
+        widths[i] = maxLineWidth(cells[i].text);
+    }
+    size_t measured = 0;
+    for (const auto& element : m_range) {
+        if (sampleRows.has_value() && measured++ == *sampleRows) {
+            break;
+        }
+        viewElement(element, cells, buffers);
+        for (size_t i = 0; i < kColumns; ++i) {
+            widths[i] = std::max(widths[i], maxLineWidth(cells[i].text));
+        }
+    }
+    return widths;
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+std::string TableView<Range, Projections...>::str(const RenderOptions& options) const {
+    std::string result;
+    BufferedWriter out(result);
+    render(out, options);
+    return result;
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+void TableView<Range, Projections...>::renderTo(OutputSink& sink, const RenderOptions& options) const {
+    BufferedWriter out(sink);
+    render(out, options);
+    out.flush();
+}
+
+template <std::ranges::forward_range Range, typename... Projections>
+requires std::ranges::view<Range>
+void TableView<Range, Projections...>::render(BufferedWriter& out, const RenderOptions& options) const {
+    const Border& border = options.border.has_value() ? *options.border : m_border;
+    const auto widths = calculateColumnWidths(options.sampleRows);
+    std::array<Alignment, kColumns> alignments{};
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((alignments[I] = std::get<I>(m_columns).alignment), ...);
+    }(std::make_index_sequence<kColumns>{});
+    const Renderer renderer(border, widths, alignments, options.overflow);
+
+    std::array<CellView, kColumns> cells{};
+    std::array<std::string, kColumns> buffers;
+    const size_t rows = rowCount();
+
+    // Rendering into a string: size it exactly so the output is allocated once
+    if (out.direct()) {
+        viewHeader(cells);
+        size_t size = renderer.bordersSize(true, rows) + renderer.rowSize(cells);
+        for (const auto& element : m_range) {
+            viewElement(element, cells, buffers);
+            size += renderer.rowSize(cells);
+        }
+        out.reserve(size);
+    }
+
+    renderer.writeTop(out);
+
+    viewHeader(cells);
+    renderer.writeRow(out, cells);
+    renderer.writeHeaderSeparator(out);
+
+    size_t rowIdx = 0;
+    for (const auto& element : m_range) {
+        viewElement(element, cells, buffers);
+        renderer.writeRow(out, cells);
+
+        // Add row separator if not the last row
+        if (++rowIdx < rows) {
+            renderer.writeRowSeparator(out);
+        }
+    }
+
+    renderer.writeBottom(out);
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_TABLE_VIEW_HPP
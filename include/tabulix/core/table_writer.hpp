@@ -0,0 +1,202 @@
+/**
+ * @file table_writer.hpp
+ * @brief Definition of the TableWriter class
+ */
+
+#ifndef TABULIX_CORE_TABLE_WRITER_HPP
+#define TABULIX_CORE_TABLE_WRITER_HPP
+
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "render_options.hpp"
+#include "renderer.hpp"
+#include "row.hpp"
+#include "sink.hpp"
+#include "table.hpp"
+
+namespace tabulix {
+
+/**
+ * @class TableWriter
+ * @brief Writes a table row by row without holding its rows
+ *
+ * The column widths are either given up front or sampled from the first
+ * rows, which are held until the sample is complete. After that every row
+ * is rendered and handed to the sink as soon as it is written, so memory
+ * stays proportional to the number of columns however many rows pass
+ * through. Output is the same as rendering a Table with these widths: the
+ * separator before a row is written together with it, and the bottom border
+ * by finish().
+ *
+ * @code
+ * tabulix::FileDescriptorSink out(STDOUT_FILENO);
+ * tabulix::TableWriter writer(out, {"Time", "Event"}, {.sampleRows = 100});
+ * while (auto event = consumer.poll()) {
+ *     writer.writeRow({event->time, event->text});
+ * }
+ * writer.finish();
+ * @endcode
+ */
+class TableWriter {
+public:
+    /**
+     * @brief Default number of rows columns are sized from when no widths are given
+     */
+    static constexpr size_t kDefaultSampleRows = 100;
+
+    /**
+     * @brief Constructor with fixed column widths
+     *
+     * Rows are written immediately; lines wider than their column are
+     * handled according to @p options.overflow.
+     *
+     * @param sink Destination for the table
+     * @param header Header cells (no header row if empty)
+     * @param columnWidths Width of every column in terminal columns
+     * @param options Border (the GRID theme if unset) and overflow handling
+     */
+    TableWriter(OutputSink& sink, const std::vector<std::string>& header,
+                std::vector<size_t> columnWidths, const RenderOptions& options = {});
+
+    /**
+     * @brief Constructor with fixed column widths given as a list
+     *
+     * Keeps a braced list of widths from being taken for RenderOptions.
+     *
+     * @param sink Destination for the table
+     * @param header Header cells (no header row if empty)
+     * @param columnWidths Width of every column in terminal columns
+     * @param options Border (the GRID theme if unset) and overflow handling
+     */
+    TableWriter(OutputSink& sink, const std::vector<std::string>& header,
+                std::initializer_list<size_t> columnWidths, const RenderOptions& options = {});
+
+    /**
+     * @brief Constructor sizing columns from a sample of the rows
+     *
+     * The first @p options.sampleRows rows (kDefaultSampleRows if unset) are
+     * held back until the sample is complete or finish() is called.
+     *
+     * @param sink Destination for the table
+     * @param header Header cells (no header row if empty)
+     * @param options Sample size, border (the GRID theme if unset) and overflow handling
+     */
+    TableWriter(OutputSink& sink, const std::vector<std::string>& header, const RenderOptions& options = {});
+
+    /**
+     * @brief Destructor, finishing the table if finish() was not called
+     *
+     * Errors of the sink are ignored here; call finish() to observe them.
+     */
+    ~TableWriter();
+
+    TableWriter(const TableWriter&) = delete;
+    TableWriter& operator=(const TableWriter&) = delete;
+
+    /**
+     * @brief Set alignment for a column
+     *
+     * Applies to the rows written afterwards, and to the header if it has
+     * not been written yet.
+     *
+     * @param columnIndex Index of the column (0-based)
+     * @param alignment Alignment to apply
+     * @return Reference to this writer for method chaining
+     */
+    TableWriter& setColumnAlignment(size_t columnIndex, Alignment alignment);
+
+    /**
+     * @brief Write a row of text cells
+     * @param cells Cell values; cells beyond the column count are left out
+     * @return Reference to this writer for method chaining
+     * @throws std::logic_error if the table was finished
+     */
+    TableWriter& writeRow(std::span<const std::string_view> cells);
+
+    /**
+     * @brief Write a row of text cells
+     * @param cells Cell values; cells beyond the column count are left out
+     * @return Reference to this writer for method chaining
+     * @throws std::logic_error if the table was finished
+     */
+    TableWriter& writeRow(std::initializer_list<std::string_view> cells);
+
+    /**
+     * @brief Write a row, including numeric cells and cell alignments
+     * @param row Row to write
+     * @return Reference to this writer for method chaining
+     * @throws std::logic_error if the table was finished
+     */
+    TableWriter& writeRow(const Row& row);
+
+    /**
+     * @brief Get the number of rows written so far
+     * @return Number of data rows, including rows held for sampling
+     */
+    [[nodiscard]] size_t rowCount() const noexcept;
+
+    /**
+     * @brief Get the column widths
+     * @return Width of every column, empty while the sample is incomplete
+     */
+    [[nodiscard]] std::span<const size_t> columnWidths() const noexcept;
+
+    /**
+     * @brief Write the remaining sampled rows and the bottom border, then flush
+     *
+     * Calling finish() more than once has no effect.
+     */
+    void finish();
+
+private:
+    BufferedWriter m_out;
+    Border m_border;
+    Overflow m_overflow;
+    std::vector<std::string> m_header;
+    std::vector<size_t> m_widths;
+    std::vector<Alignment> m_alignments;
+    std::optional<Renderer> m_renderer;
+
+    // Rows held back until the sample is complete
+    std::optional<Table> m_sample;
+    size_t m_sampleRows = 0;
+
+    // Views of the row being written
+    std::vector<CellView> m_cells;
+    std::vector<std::string> m_numbers;
+
+    size_t m_rows = 0;
+    size_t m_emitted = 0;
+    bool m_started = false;
+    bool m_finished = false;
+
+    /**
+     * @brief Fix the widths and write the top border and header
+     */
+    void start();
+
+    /**
+     * @brief Render one data row with its preceding separator
+     * @param cells Cell views of the row
+     */
+    void emitRow(std::span<const CellView> cells);
+
+    /**
+     * @brief Render a Row through the per-column scratch views
+     * @param row Row to render
+     */
+    void emitRow(const Row& row);
+
+    /**
+     * @brief Throw if the table was finished
+     */
+    void checkOpen() const;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_TABLE_WRITER_HPP
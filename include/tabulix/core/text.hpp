@@ -0,0 +1,67 @@
+/**
+ * @file text.hpp
+ * @brief Text measurement helpers shared by tables and the renderer
+ */
+
+#ifndef TABULIX_CORE_TEXT_HPP
+#define TABULIX_CORE_TEXT_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace tabulix {
+
+/**
+ * @brief Find the first newline character in a text
+ *
+ * Scans 32 or 16 bytes at a time with AVX2 or SSE2 when the build targets
+ * them, and falls back to a scalar scan otherwise.
+ *
+ * @param text Text to scan
+ * @return Offset of the first newline, or std::string_view::npos if there is none
+ */
+[[nodiscard]] size_t findNewline(std::string_view text) noexcept;
+
+/**
+ * @brief Count the newline characters in a text
+ * @param text Text to scan
+ * @return Number of newline characters
+ */
+[[nodiscard]] size_t countNewlines(std::string_view text) noexcept;
+
+/**
+ * @brief Split text by newline characters for multiline support
+ *
+ * A trailing newline does not produce an extra empty line, and empty text
+ * yields a single empty line.
+ *
+ * @param text Text to split
+ * @return Views of the individual lines into @p text
+ */
+[[nodiscard]] std::vector<std::string_view> splitLines(std::string_view text);
+
+/**
+ * @brief Count the lines splitLines would produce, without allocating
+ * @param text Text to analyze
+ * @return Number of lines (at least 1)
+ */
+[[nodiscard]] size_t countLines(std::string_view text) noexcept;
+
+/**
+ * @brief Remove the first line from a text and return it
+ * @param text Remaining text; advanced past the line and its newline
+ * @return The first line, or an empty view once the text is exhausted
+ */
+[[nodiscard]] std::string_view nextLine(std::string_view& text) noexcept;
+
+/**
+ * @brief Get the maximum line width in a multiline text
+ * @param text Text to analyze
+ * @return Maximum display width among all lines, in terminal columns
+ */
+[[nodiscard]] size_t maxLineWidth(std::string_view text);
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_TEXT_HPP
@@ -0,0 +1,59 @@
+/**
+ * @file width.hpp
+ * @brief Terminal display width of UTF-8 text
+ */
+
+#ifndef TABULIX_CORE_WIDTH_HPP
+#define TABULIX_CORE_WIDTH_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace tabulix {
+
+/**
+ * @struct FittedText
+ * @brief Prefix of a text that fits into a number of terminal columns
+ */
+struct FittedText {
+    std::string_view text; ///< Longest prefix that fits, cut at a character boundary
+    size_t width;          ///< Display width of the prefix in columns
+};
+
+/**
+ * @brief Get the number of leading bytes of a text that are 7-bit ASCII
+ * @param text Text to scan
+ * @return Length of the ASCII prefix in bytes
+ */
+[[nodiscard]] size_t asciiPrefixLength(std::string_view text) noexcept;
+
+/**
+ * @brief Get the display width of a single line of UTF-8 text
+ *
+ * ASCII text is measured with a vectorized scan. Other text is decoded and
+ * looked up in compact East Asian Width and zero-width tables: wide and
+ * fullwidth characters and emoji take two columns, combining marks and
+ * joiners take none, and ZWJ sequences, skin-tone modifiers and flag pairs
+ * count as one cluster. Invalid bytes take one column each.
+ *
+ * @param text Line to measure
+ * @return Width in terminal columns
+ */
+[[nodiscard]] size_t displayWidth(std::string_view text) noexcept;
+
+/**
+ * @brief Get the longest prefix of a line that fits into a number of columns
+ *
+ * A wide character that would straddle the limit is left out, so the
+ * resulting width may be smaller than @p maxWidth. Zero-width characters
+ * following the last included character are kept with it.
+ *
+ * @param text Line to fit
+ * @param maxWidth Available width in columns
+ * @return The fitting prefix and its display width
+ */
+[[nodiscard]] FittedText fitToWidth(std::string_view text, size_t maxWidth) noexcept;
+
+} // namespace tabulix
+
+#endif // TABULIX_CORE_WIDTH_HPP
@@ -7,8 +7,9 @@
 #define TABULIX_EXPORT_EXPORTER_HPP
 
 #include <string>
-#include <fstream>
 #include <memory>
+#include <system_error>
+#include "../core/columnar_table.hpp"
 #include "../core/table.hpp"
 
 namespace tabulix {
@@ -22,12 +23,36 @@ enum class ExportFormat {
     MARKDOWN, ///< Markdown table
     HTML,     ///< HTML table
     CSV,      ///< Comma-separated values
-    JSON      ///< JSON format
+    JSON,     ///< JSON format
+    BINARY    ///< Binary snapshot (see TableSnapshot)
+};
+
+/**
+ * @struct ExportResult
+ * @brief Outcome of exporting a table to a file
+ */
+struct ExportResult {
+    size_t bytesWritten = 0; ///< Number of bytes written to the file
+    std::error_code error;   ///< Reason of the failure, empty on success
+
+    /**
+     * @brief Check whether the export succeeded
+     *
+     * The conversion is implicit so that callers written when toFile
+     * returned bool, such as `bool ok = exporter.toFile(table, path);`,
+     * keep compiling.
+     *
+     * @return true if no error occurred
+     */
+    operator bool() const noexcept { return !error; }
 };
 
 /**
  * @class Exporter
  * @brief Abstract base class for table exporters
+ *
+ * Every exporter accepts both a Table and a ColumnarTable; a ColumnarTable
+ * gives the same output as a Table holding the same text.
  */
 class Exporter {
 public:
@@ -43,13 +68,57 @@ public:
      */
     [[nodiscard]] virtual std::string toString(const Table& table) const = 0;
 
+    /**
+     * @brief Export a table into an output sink
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    virtual void toSink(const Table& table, OutputSink& sink) const;
+
     /**
      * @brief Export a table to a file
+     *
+     * The file is written through toSink with FileDescriptorSink::kChunkSize
+     * chunks handed to write(2), so the export never has to fit in memory.
+     *
      * @param table Table to export
      * @param filename Path to the output file
-     * @return true if export was successful, false otherwise
+     * @return Number of bytes written, and the system error if opening,
+     *         writing or closing the file failed (running out of memory is
+     *         reported as std::errc::not_enough_memory)
+     * @throws Any other exception thrown by toSink, after closing the file;
+     *         this includes std::system_error not raised by the file, such as
+     *         failing to start a render thread
+     */
+    virtual ExportResult toFile(const Table& table, const std::string& filename) const;
+
+    /**
+     * @brief Export a columnar table to a string
+     *
+     * The default exports the copy made by ColumnarTable::toTable(), so an
+     * exporter only overriding the Table overloads handles both.
+     *
+     * @param table Table to export
+     * @return Exported table as string
      */
-    virtual bool toFile(const Table& table, const std::string& filename) const;
+    [[nodiscard]] virtual std::string toString(const ColumnarTable& table) const;
+
+    /**
+     * @brief Export a columnar table into an output sink
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    virtual void toSink(const ColumnarTable& table, OutputSink& sink) const;
+
+    /**
+     * @brief Export a columnar table to a file, as toFile does for a Table
+     * @param table Table to export
+     * @param filename Path to the output file
+     * @return Number of bytes written, and the system error if opening,
+     *         writing or closing the file failed
+     * @throws Any exception toSink throws other than a file error or std::bad_alloc
+     */
+    virtual ExportResult toFile(const ColumnarTable& table, const std::string& filename) const;
 
     /**
      * @brief Factory method to create an exporter for a specific format
@@ -71,11 +140,35 @@ public:
      * @return Exported table as string
      */
     [[nodiscard]] std::string toString(const Table& table) const override;
+
+    /**
+     * @brief Export a table into an output sink in plain text format
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string in plain text format
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink in plain text format
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
 };
 
 /**
  * @class MarkdownExporter
  * @brief Exports tables in Markdown format
+ *
+ * The table is rendered with the Markdown border passed as a render
+ * option, so it is neither copied nor modified.
  */
 class MarkdownExporter : public Exporter {
 public:
@@ -85,11 +178,38 @@ public:
      * @return Exported table as string
      */
     [[nodiscard]] std::string toString(const Table& table) const override;
+
+    /**
+     * @brief Export a table into an output sink in Markdown format
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string in Markdown format
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink in Markdown format
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
 };
 
 /**
  * @class HtmlExporter
  * @brief Exports tables in HTML format
+ *
+ * The header row goes into a thead and the data rows into a tbody. Centered
+ * and right-aligned cells get a text-align style from the cell or column
+ * alignment, special characters are replaced by entities and newlines by
+ * line breaks. When exporting into a sink, the head is flushed before the
+ * body and the body follows in chunks, so it can be displayed progressively.
  */
 class HtmlExporter : public Exporter {
 public:
@@ -99,11 +219,39 @@ public:
      * @return Exported table as string
      */
     [[nodiscard]] std::string toString(const Table& table) const override;
+
+    /**
+     * @brief Export a table into an output sink in HTML format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string in HTML format
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink in HTML format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
 };
 
 /**
  * @class CsvExporter
  * @brief Exports tables in CSV format
+ *
+ * Output follows RFC 4180: records end with CRLF, every record has one
+ * field per column (like the text rendering, cells beyond the column count
+ * are left out and missing cells are empty), numeric cells use their column
+ * format, and fields containing the delimiter, a double quote,
+ * CR or LF are enclosed in double quotes with embedded quotes doubled.
+ * Fields without such characters are copied verbatim.
  */
 class CsvExporter : public Exporter {
 public:
@@ -120,22 +268,128 @@ public:
      */
     [[nodiscard]] std::string toString(const Table& table) const override;
 
+    /**
+     * @brief Export a table into an output sink in CSV format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string in CSV format
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink in CSV format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
+
 private:
     char m_delimiter;
 };
 
+/**
+ * @enum JsonLayout
+ * @brief Shapes of the JSON document written by JsonExporter
+ */
+enum class JsonLayout {
+    ARRAY_OF_OBJECTS, ///< [{"col": "value", ...}, ...]
+    COLUMNAR,         ///< {"col": ["value", ...], ...}
+    NDJSON            ///< One {"col": "value", ...} object per line
+};
+
 /**
  * @class JsonExporter
  * @brief Exports tables in JSON format
+ *
+ * Objects are keyed by the header cells, or by the zero-based column index
+ * when the table has no header. Numeric cells are written as JSON numbers
+ * (null for NaN and infinity) and all other cells as JSON strings.
+ * The document is written straight to the output without building a DOM.
  */
 class JsonExporter : public Exporter {
 public:
+    /**
+     * @brief Constructor
+     * @param layout Shape of the exported document
+     */
+    explicit JsonExporter(JsonLayout layout = JsonLayout::ARRAY_OF_OBJECTS);
+
     /**
      * @brief Export a table to a string in JSON format
      * @param table Table to export
      * @return Exported table as string
      */
     [[nodiscard]] std::string toString(const Table& table) const override;
+
+    /**
+     * @brief Export a table into an output sink in JSON format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string in JSON format
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink in JSON format, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
+
+private:
+    JsonLayout m_layout;
+};
+
+/**
+ * @class BinaryExporter
+ * @brief Exports tables as binary snapshots
+ *
+ * The snapshot keeps cells, styling and column widths, so it can be
+ * rendered again by TableSnapshot without parsing or measuring anything.
+ * See writeSnapshot for the layout. A ColumnarTable is copied into a Table
+ * first, since the snapshot is written from one.
+ */
+class BinaryExporter : public Exporter {
+public:
+    /**
+     * @brief Export a table to a string holding a binary snapshot
+     * @param table Table to export
+     * @return Snapshot bytes
+     */
+    [[nodiscard]] std::string toString(const Table& table) const override;
+
+    /**
+     * @brief Export a table into an output sink as a binary snapshot, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const Table& table, OutputSink& sink) const override;
+
+    /**
+     * @brief Export a columnar table to a string holding a binary snapshot
+     * @param table Table to export
+     * @return Exported table as string
+     */
+    [[nodiscard]] std::string toString(const ColumnarTable& table) const override;
+
+    /**
+     * @brief Export a columnar table into an output sink as a binary snapshot, one chunk at a time
+     * @param table Table to export
+     * @param sink Destination for the exported data
+     */
+    void toSink(const ColumnarTable& table, OutputSink& sink) const override;
 };
 
 } // namespace tabulix
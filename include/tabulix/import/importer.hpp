@@ -0,0 +1,91 @@
+/**
+ * @file importer.hpp
+ * @brief Definition of the table importers
+ */
+
+#ifndef TABULIX_IMPORT_IMPORTER_HPP
+#define TABULIX_IMPORT_IMPORTER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "../core/table.hpp"
+
+namespace tabulix {
+
+/**
+ * @struct ImportOptions
+ * @brief Per-call settings for importing a table
+ */
+struct ImportOptions {
+    /**
+     * @brief Whether the first record holds the column headers
+     */
+    bool header = true;
+
+    /**
+     * @brief Number of threads parsing records (0 for one per hardware thread)
+     *
+     * The result is identical for every thread count. Input smaller than two
+     * blocks is always parsed on the calling thread.
+     */
+    unsigned threads = 1;
+
+    /**
+     * @brief Number of input bytes parsed by one thread at a time
+     */
+    size_t bytesPerBlock = size_t{1} << 20;
+};
+
+/**
+ * @class CsvImporter
+ * @brief Imports delimiter-separated text (CSV, TSV) into a Table
+ *
+ * The counterpart of CsvExporter. Fields may be enclosed in double quotes,
+ * in which case they can contain delimiters, line breaks and doubled quotes.
+ * Records end with LF or CRLF, and a UTF-8 byte order mark is skipped. Input
+ * is scanned for delimiters, quotes and newlines 16 or 32 bytes at a time
+ * with SSE2 or AVX2, and every field is copied once, straight into cells
+ * allocated from the table's memory resource.
+ *
+ * Parsing on several threads splits the input at record boundaries found
+ * by tracking quote parity, which requires quotes to appear only around
+ * fields as in RFC 4180. Input with stray quotes inside unquoted fields
+ * should be parsed on one thread.
+ */
+class CsvImporter {
+public:
+    /**
+     * @brief Constructor
+     * @param delimiter Field delimiter (default is comma, '\t' for TSV)
+     */
+    explicit CsvImporter(char delimiter = ',');
+
+    /**
+     * @brief Import a table from text
+     * @param data Delimiter-separated text
+     * @param options Import options
+     * @param alloc Allocator of the resulting table
+     * @return Table with one row per record
+     */
+    [[nodiscard]] Table fromString(std::string_view data, const ImportOptions& options = {},
+                                   const Table::allocator_type& alloc = {}) const;
+
+    /**
+     * @brief Import a table from a file mapped into memory
+     * @param filename Path to the file
+     * @param options Import options
+     * @param alloc Allocator of the resulting table
+     * @return Table with one row per record
+     * @throws std::system_error if the file cannot be opened or mapped
+     */
+    [[nodiscard]] Table fromFile(const std::string& filename, const ImportOptions& options = {},
+                                 const Table::allocator_type& alloc = {}) const;
+
+private:
+    char m_delimiter;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_IMPORT_IMPORTER_HPP
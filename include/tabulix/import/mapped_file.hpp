@@ -0,0 +1,76 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Definition of the MappedFile class
+ */
+
+#ifndef TABULIX_IMPORT_MAPPED_FILE_HPP
+#define TABULIX_IMPORT_MAPPED_FILE_HPP
+
+#include <string>
+#include <string_view>
+
+namespace tabulix {
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file mapped into memory
+ *
+ * On POSIX systems the file is mapped with mmap(2), so opening it costs
+ * the same whatever its size and pages are only read when touched. Other
+ * platforms read the file into memory instead.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a file
+     * @param filename Path to the file
+     * @throws std::system_error if the file cannot be opened, inspected or mapped
+     */
+    explicit MappedFile(const std::string& filename);
+
+    /**
+     * @brief Destructor, unmapping the file
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Move constructor
+     */
+    MappedFile(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Move assignment
+     */
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Get the file content
+     * @return View of the whole file, valid while the mapping lives
+     */
+    [[nodiscard]] std::string_view data() const noexcept;
+
+    /**
+     * @brief Get the file size
+     * @return Size in bytes
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+#if defined(_WIN32)
+    std::string m_buffer;
+#endif
+
+    /**
+     * @brief Release the mapping
+     */
+    void unmap() noexcept;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_IMPORT_MAPPED_FILE_HPP
@@ -0,0 +1,286 @@
+/**
+ * @file snapshot.hpp
+ * @brief Definition of the binary table snapshot format and the TableSnapshot class
+ */
+
+#ifndef TABULIX_IMPORT_SNAPSHOT_HPP
+#define TABULIX_IMPORT_SNAPSHOT_HPP
+
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "mapped_file.hpp"
+#include "../core/cell.hpp"
+#include "../core/format.hpp"
+#include "../core/render_options.hpp"
+#include "../core/renderer.hpp"
+#include "../core/sink.hpp"
+#include "../core/table.hpp"
+#include "../styling/alignment.hpp"
+#include "../styling/border.hpp"
+#include "../styling/theme.hpp"
+
+namespace tabulix {
+
+/**
+ * @brief Write a table in the binary snapshot format
+ *
+ * A snapshot holds the header, every cell (text, or the unformatted number),
+ * cell and column alignments, column formats, the column widths the table
+ * renders with, fixed widths, the theme and the border. It is laid out as
+ * a fixed-size file header followed by sections at 8-byte aligned offsets:
+ * the border strings, one record per column, the index of the first cell of
+ * every row, one fixed-size record per cell, and the string bytes cells
+ * point into. Integers are stored in the byte order of the writer.
+ *
+ * @param table Table to write
+ * @param out Writer receiving the snapshot; sized exactly when writing into a string
+ */
+void writeSnapshot(const Table& table, BufferedWriter& out);
+
+/**
+ * @class TableSnapshot
+ * @brief Read-only table backed by a binary snapshot
+ *
+ * Opening a snapshot only checks its file header and decodes the column
+ * records: cells are read from the mapped file when accessed, so opening
+ * costs the same whatever the number of rows. Rendering formats cells
+ * straight from the mapping with the stored column widths, without
+ * building a Table. Sections and cells are bounds-checked as they are
+ * read; a snapshot written on a machine with another byte order is
+ * rejected.
+ *
+ * @code
+ * tabulix::Exporter::create(tabulix::ExportFormat::BINARY)->toFile(table, "report.tbx");
+ * const auto snapshot = tabulix::TableSnapshot::fromFile("report.tbx");
+ * std::cout << snapshot;
+ * @endcode
+ */
+class TableSnapshot {
+public:
+    /**
+     * @brief Open a snapshot file
+     * @param filename Path to the snapshot
+     * @return Snapshot over the mapped file
+     * @throws std::system_error if the file cannot be mapped
+     * @throws std::runtime_error if the file is not a valid snapshot
+     */
+    [[nodiscard]] static TableSnapshot fromFile(const std::string& filename);
+
+    /**
+     * @brief Open a snapshot held in memory
+     * @param data Snapshot bytes; must outlive the returned snapshot
+     * @return Snapshot over @p data
+     * @throws std::runtime_error if the data is not a valid snapshot
+     */
+    [[nodiscard]] static TableSnapshot fromString(std::string_view data);
+
+    /**
+     * @brief Get the number of rows in the snapshot (including header)
+     * @return Number of rows
+     */
+    [[nodiscard]] size_t rowCount() const noexcept;
+
+    /**
+     * @brief Get the number of columns
+     * @return Number of columns
+     */
+    [[nodiscard]] size_t columnCount() const noexcept;
+
+    /**
+     * @brief Check whether the snapshot has a header row
+     * @return true if a header was stored
+     */
+    [[nodiscard]] bool hasHeader() const noexcept;
+
+    /**
+     * @brief Get a header cell
+     * @param columnIndex Index of the column (0-based)
+     * @return Header text, valid while the snapshot lives
+     * @throws std::out_of_range if there is no header or no such header cell
+     */
+    [[nodiscard]] std::string_view header(size_t columnIndex) const;
+
+    /**
+     * @brief Get the number of cells of a data row
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @return Number of cells stored for the row
+     * @throws std::out_of_range if the row does not exist
+     */
+    [[nodiscard]] size_t cellCount(size_t rowIndex) const;
+
+    /**
+     * @brief Get the text of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return Cell text, valid while the snapshot lives (empty for numeric cells)
+     * @throws std::out_of_range if the row or cell does not exist
+     */
+    [[nodiscard]] std::string_view value(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the number held by a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return The number, or std::nullopt for a text cell
+     * @throws std::out_of_range if the row or cell does not exist
+     */
+    [[nodiscard]] std::optional<Cell::Number> number(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the alignment of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return The cell alignment, or std::nullopt if the column alignment applies
+     * @throws std::out_of_range if the row or cell does not exist
+     */
+    [[nodiscard]] std::optional<Alignment> alignment(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the default alignment of a column
+     * @param columnIndex Index of the column (0-based)
+     * @return Alignment of the column (LEFT if out of range)
+     */
+    [[nodiscard]] Alignment columnAlignment(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the format of numeric cells in a column
+     * @param columnIndex Index of the column (0-based)
+     * @return Format of the column (the default format if out of range)
+     */
+    [[nodiscard]] const FormatSpec& columnFormat(size_t columnIndex) const noexcept;
+
+    /**
+     * @brief Get the column widths the table was rendered with
+     * @return Vector of column widths in characters
+     */
+    [[nodiscard]] const std::vector<size_t>& columnWidths() const noexcept;
+
+    /**
+     * @brief Get the theme of the table
+     * @return Theme the table was written with
+     */
+    [[nodiscard]] Theme theme() const noexcept;
+
+    /**
+     * @brief Get the border of the table
+     * @return Border the table was written with, which may be a custom one
+     */
+    [[nodiscard]] const Border& border() const noexcept;
+
+    /**
+     * @brief Copy the snapshot into a Table
+     * @param alloc Allocator for rows and cell contents of the table
+     * @return Table with the same content, styling and fixed widths
+     * @throws std::runtime_error if a cell of the snapshot is corrupt
+     */
+    [[nodiscard]] Table toTable(const Table::allocator_type& alloc = {}) const;
+
+    /**
+     * @brief Get a string representation of the snapshot
+     *
+     * The output is the same as rendering the table the snapshot was written from.
+     *
+     * @param options Rendering options (border, paging and overflow are honored; the stored
+     *                widths are used and rows render on one thread)
+     * @return Formatted table as string
+     */
+    [[nodiscard]] std::string str(const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Render the snapshot into an output sink in bounded chunks
+     * @param sink Destination for the rendered table
+     * @param options Rendering options (border, paging and overflow are honored; the stored
+     *                widths are used and rows render on one thread)
+     */
+    void renderTo(OutputSink& sink, const RenderOptions& options = {}) const;
+
+    /**
+     * @brief Output stream operator overload
+     * @param os Output stream
+     * @param snapshot Snapshot to output
+     * @return Reference to the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const TableSnapshot& snapshot);
+
+private:
+    // Keeps the mapping alive when opened from a file
+    std::optional<MappedFile> m_file;
+    std::string_view m_data;
+
+    size_t m_columns = 0;
+    size_t m_rows = 0;
+    bool m_hasHeader = false;
+    Theme m_theme = Theme::GRID;
+    Border m_border;
+
+    // Decoded column records
+    std::vector<size_t> m_widths;
+    std::vector<std::optional<size_t>> m_fixedWidths;
+    std::vector<Alignment> m_alignments;
+    std::vector<FormatSpec> m_formats;
+
+    // Sections of m_data
+    size_t m_recordsOffset = 0;
+    size_t m_cellsOffset = 0;
+    size_t m_cellCount = 0;
+    size_t m_stringsOffset = 0;
+    size_t m_stringsSize = 0;
+
+    TableSnapshot() = default;
+
+    /**
+     * @brief Validate the file header and decode the border and column records
+     * @throws std::runtime_error if the data is not a valid snapshot
+     */
+    void open();
+
+    /**
+     * @brief Get the cell range of a record
+     * @param record Index of the record (the header is record 0 if present)
+     * @return Index of the first cell and number of cells
+     * @throws std::runtime_error if the index is corrupt
+     */
+    [[nodiscard]] std::pair<size_t, size_t> recordCells(size_t record) const;
+
+    /**
+     * @brief Get the index of a data cell
+     * @param rowIndex Index of the data row (0-based, header excluded)
+     * @param columnIndex Index of the column (0-based)
+     * @return Index into the cell section
+     * @throws std::out_of_range if the row or cell does not exist
+     */
+    [[nodiscard]] size_t dataCell(size_t rowIndex, size_t columnIndex) const;
+
+    /**
+     * @brief Get the text of a cell
+     * @param cell Index into the cell section
+     * @return Text of the cell, empty for numeric cells
+     * @throws std::runtime_error if the cell is corrupt
+     */
+    [[nodiscard]] std::string_view cellText(size_t cell) const;
+
+    /**
+     * @brief View a cell for rendering
+     * @param cell Index into the cell section
+     * @param buffer Scratch buffer numbers are formatted into
+     * @param format Format of numeric cells
+     * @return Text and alignment of the cell
+     * @throws std::runtime_error if the cell is corrupt
+     */
+    [[nodiscard]] CellView viewCell(size_t cell, std::string& buffer, const FormatSpec& format) const;
+
+    /**
+     * @brief Render the snapshot into a buffered writer
+     * @param out Writer receiving the formatted table
+     * @param options Rendering options
+     */
+    void render(BufferedWriter& out, const RenderOptions& options) const;
+};
+
+} // namespace tabulix
+
+#endif // TABULIX_IMPORT_SNAPSHOT_HPP
@@ -14,10 +14,25 @@
 #include "core/table.hpp"
 #include "core/cell.hpp"
 #include "core/row.hpp"
+#include "core/columnar_table.hpp"
+#include "core/table_view.hpp"
+#include "core/live_table.hpp"
+#include "core/table_writer.hpp"
+#include "core/renderer.hpp"
+#include "core/render_options.hpp"
+#include "core/sort_options.hpp"
+#include "core/parallel.hpp"
+#include "core/text.hpp"
+#include "core/format.hpp"
+#include "core/width.hpp"
+#include "core/sink.hpp"
 #include "styling/theme.hpp"
 #include "styling/border.hpp"
 #include "styling/alignment.hpp"
 #include "export/exporter.hpp"
+#include "import/importer.hpp"
+#include "import/mapped_file.hpp"
+#include "import/snapshot.hpp"
 
 /**
  * @namespace tabulix
@@ -4,19 +4,73 @@
  */
 
 #include "tabulix/core/cell.hpp"
+#include "tabulix/core/text.hpp"
 #include <algorithm>
+#include <concepts>
 
 namespace tabulix {
 
-Cell::Cell(std::string value) : m_value(std::move(value)) {
+Cell::Cell(const allocator_type& alloc) noexcept : m_value(alloc) {
 }
 
-const std::string& Cell::value() const noexcept {
+Cell::Cell(std::string_view value, const allocator_type& alloc) : m_value(value, alloc) {
+}
+
+Cell::Cell(const Cell& other, const allocator_type& alloc)
+    : m_value(other.m_value, alloc)
+    , m_number(other.m_number)
+    , m_alignment(other.m_alignment) {
+}
+
+Cell::Cell(Cell&& other, const allocator_type& alloc)
+    : m_value(std::move(other.m_value), alloc)
+    , m_number(other.m_number)
+    , m_alignment(other.m_alignment) {
+}
+
+Cell::allocator_type Cell::get_allocator() const noexcept {
+    return m_value.get_allocator();
+}
+
+std::string_view Cell::value() const noexcept {
+    return m_value;
+}
+
+std::string Cell::text(const FormatSpec& spec) const {
+    if (!isNumeric()) {
+        return std::string(m_value);
+    }
+    std::string buffer;
+    return std::string(format(buffer, spec));
+}
+
+std::optional<Cell::Number> Cell::number() const noexcept {
+    if (const auto* integer = std::get_if<int64_t>(&m_number)) {
+        return *integer;
+    }
+    if (const auto* real = std::get_if<double>(&m_number)) {
+        return *real;
+    }
+    return std::nullopt;
+}
+
+bool Cell::isNumeric() const noexcept {
+    return !std::holds_alternative<std::monostate>(m_number);
+}
+
+std::string_view Cell::format(std::string& buffer, const FormatSpec& spec) const {
+    if (const auto* integer = std::get_if<int64_t>(&m_number)) {
+        return formatNumber(buffer, *integer, spec);
+    }
+    if (const auto* real = std::get_if<double>(&m_number)) {
+        return formatNumber(buffer, *real, spec);
+    }
     return m_value;
 }
 
-Cell& Cell::setValue(std::string value) {
-    m_value = std::move(value);
+Cell& Cell::setValue(std::string_view value) {
+    m_value.assign(value);
+    m_number = std::monostate{};
     return *this;
 }
 
@@ -34,25 +88,29 @@ Cell& Cell::resetAlignment() noexcept {
     return *this;
 }
 
-size_t Cell::width() const {
-    // Count visible width (handle multiline content)
-    if (m_value.empty()) {
-        return 0;
-    }
-
-    size_t maxWidth = 0;
-    size_t currentWidth = 0;
-
-    for (char c : m_value) {
-        if (c == '\n') {
-            maxWidth = std::max(maxWidth, currentWidth);
-            currentWidth = 0;
-        } else {
-            currentWidth++;
+size_t Cell::width(const FormatSpec& spec) const {
+    if (isNumeric()) {
+        // Formatted numbers are plain ASCII: their length is their width
+        char digits[64];
+        char* end = std::visit([&](auto value) -> char* {
+            if constexpr (std::same_as<decltype(value), std::monostate>) {
+                return digits;
+            } else {
+                return formatNumber(digits, digits + sizeof(digits), value, spec);
+            }
+        }, m_number);
+        if (end != nullptr) {
+            return static_cast<size_t>(end - digits);
         }
+        std::string buffer;
+        return format(buffer, spec).size();
     }
 
-    return std::max(maxWidth, currentWidth);
+    // Widest line in terminal columns (handles multiline content)
+    if (m_value.empty()) {
+        return 0;
+    }
+    return maxLineWidth(m_value);
 }
 
 } // namespace tabulix
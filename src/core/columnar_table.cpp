@@ -0,0 +1,382 @@
+/**
+ * @file columnar_table.cpp
+ * @brief Implementation of the ColumnarTable class
+ */
+
+#include "tabulix/core/columnar_table.hpp"
+#include "tabulix/core/parallel.hpp"
+#include "tabulix/core/renderer.hpp"
+#include "tabulix/core/text.hpp"
+#include "render_range.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace tabulix {
+
+ColumnarTable::ColumnarTable(const std::vector<std::string>& headers) {
+    addHeader(headers);
+}
+
+ColumnarTable::ColumnarTable(std::initializer_list<std::string> headers) {
+    addHeader(headers);
+}
+
+ColumnarTable& ColumnarTable::addHeader(const std::vector<std::string>& headers) {
+    m_header = headers;
+
+    // Ensure column alignments and widths are initialized
+    if (m_columnAlignments.size() < headers.size()) {
+        m_columnAlignments.resize(headers.size(), Alignment::LEFT);
+    }
+    if (m_columnWidths.size() < headers.size()) {
+        m_columnWidths.resize(headers.size(), std::nullopt);
+    }
+
+    return *this;
+}
+
+ColumnarTable& ColumnarTable::addHeader(std::initializer_list<std::string> headers) {
+    return addHeader(std::vector<std::string>(headers));
+}
+
+ColumnarTable& ColumnarTable::addRow(const Row& row) {
+    // Columnar storage is text only: numeric cells are stored in their default format
+    std::vector<std::string> numbers(row.size());
+    std::vector<std::string_view> views;
+    views.reserve(row.size());
+    for (size_t i = 0; i < row.size(); ++i) {
+        views.emplace_back(row.at(i).format(numbers[i]));
+    }
+
+    const size_t rowIndex = m_rows;
+    appendRow(views);
+
+    for (size_t i = 0; i < row.size(); ++i) {
+        if (const auto alignment = row.at(i).alignment()) {
+            m_cellAlignments[{rowIndex, i}] = *alignment;
+        }
+    }
+
+    return *this;
+}
+
+void ColumnarTable::appendRow(std::span<const std::string_view> cells) {
+    // A row wider than any before it adds columns that are empty for earlier rows
+    while (m_columns.size() < cells.size()) {
+        auto& column = m_columns.emplace_back();
+        column.offsets.assign(m_rows + 1, 0);
+    }
+
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+        auto& column = m_columns[i];
+        if (i < cells.size()) {
+            column.arena.append(cells[i]);
+        }
+        column.offsets.push_back(column.arena.size());
+    }
+
+    // Ensure column alignments and widths are initialized if this is the first row
+    if (m_rows == 0) {
+        m_firstRowSize = cells.size();
+        if (m_columnAlignments.empty()) {
+            m_columnAlignments.resize(cells.size(), Alignment::LEFT);
+        }
+        if (m_columnWidths.empty()) {
+            m_columnWidths.resize(cells.size(), std::nullopt);
+        }
+    }
+
+    ++m_rows;
+}
+
+ColumnarTable& ColumnarTable::setCellAlignment(size_t rowIndex, size_t columnIndex, Alignment alignment) {
+    if (rowIndex >= m_rows || columnIndex >= m_columns.size()) {
+        throw std::out_of_range("ColumnarTable::setCellAlignment: cell index out of range");
+    }
+    m_cellAlignments[{rowIndex, columnIndex}] = alignment;
+    return *this;
+}
+
+ColumnarTable& ColumnarTable::setTheme(Theme theme) {
+    m_theme = theme;
+    m_border = getBorderForTheme(theme);
+    return *this;
+}
+
+ColumnarTable& ColumnarTable::setBorder(const Border& border) {
+    m_border = border;
+    return *this;
+}
+
+ColumnarTable& ColumnarTable::setColumnAlignment(size_t columnIndex, Alignment alignment) {
+    if (columnIndex >= m_columnAlignments.size()) {
+        m_columnAlignments.resize(columnIndex + 1, Alignment::LEFT);
+    }
+    m_columnAlignments[columnIndex] = alignment;
+    return *this;
+}
+
+ColumnarTable& ColumnarTable::setColumnWidth(size_t columnIndex, std::optional<size_t> width) {
+    if (columnIndex >= m_columnWidths.size()) {
+        m_columnWidths.resize(columnIndex + 1, std::nullopt);
+    }
+    m_columnWidths[columnIndex] = width;
+    return *this;
+}
+
+std::string_view ColumnarTable::cell(size_t rowIndex, size_t columnIndex) const {
+    if (rowIndex >= m_rows || columnIndex >= m_columns.size()) {
+        throw std::out_of_range("ColumnarTable::cell: cell index out of range");
+    }
+    const auto& column = m_columns[columnIndex];
+    const size_t begin = column.offsets[rowIndex];
+    return std::string_view(column.arena).substr(begin, column.offsets[rowIndex + 1] - begin);
+}
+
+const std::optional<std::vector<std::string>>& ColumnarTable::header() const noexcept {
+    return m_header;
+}
+
+std::optional<Alignment> ColumnarTable::cellAlignment(size_t rowIndex, size_t columnIndex) const {
+    const auto it = m_cellAlignments.find({rowIndex, columnIndex});
+    if (it == m_cellAlignments.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+Alignment ColumnarTable::columnAlignment(size_t columnIndex) const noexcept {
+    return columnIndex < m_columnAlignments.size() ? m_columnAlignments[columnIndex] : Alignment::LEFT;
+}
+
+const Border& ColumnarTable::border() const noexcept {
+    return m_border;
+}
+
+size_t ColumnarTable::rowCount() const noexcept {
+    return m_rows + (m_header.has_value() ? 1 : 0);
+}
+
+size_t ColumnarTable::columnCount() const noexcept {
+    if (m_header.has_value()) {
+        return m_header->size();
+    }
+    return m_rows > 0 ? m_firstRowSize : 0;
+}
+
+size_t ColumnarTable::storedColumnCount() const noexcept {
+    return m_columns.size();
+}
+
+std::vector<size_t> ColumnarTable::columnWidths() const {
+    return calculateColumnWidths();
+}
+
+bool ColumnarTable::empty() const noexcept {
+    return m_rows == 0 && !m_header.has_value();
+}
+
+ColumnarTable& ColumnarTable::clear() noexcept {
+    m_columns.clear();
+    m_cellAlignments.clear();
+    m_rows = 0;
+    m_firstRowSize = 0;
+    m_header.reset();
+    return *this;
+}
+
+Table ColumnarTable::toTable(const Table::allocator_type& alloc) const {
+    Table table(alloc);
+    if (m_header.has_value()) {
+        table.addHeader(*m_header);
+    }
+
+    // Rows keep the cells they can show: beyond the column count a Table would not render them either
+    const size_t cells = std::min(m_columns.size(), columnCount());
+    table.reserveRows(m_rows);
+    auto alignmentIt = m_cellAlignments.begin();
+    for (size_t r = 0; r < m_rows; ++r) {
+        Row row(table.get_allocator());
+        row.reserve(cells);
+        for (size_t i = 0; i < cells; ++i) {
+            row.addCell(cell(r, i));
+        }
+        for (; alignmentIt != m_cellAlignments.end() && alignmentIt->first.first == r; ++alignmentIt) {
+            if (alignmentIt->first.second < cells) {
+                row[alignmentIt->first.second].setAlignment(alignmentIt->second);
+            }
+        }
+        table.addRow(std::move(row));
+    }
+
+    table.setTheme(m_theme);
+    table.setBorder(m_border);
+    for (size_t i = 0; i < m_columnAlignments.size(); ++i) {
+        table.setColumnAlignment(i, m_columnAlignments[i]);
+    }
+    for (size_t i = 0; i < m_columnWidths.size(); ++i) {
+        table.setColumnWidth(i, m_columnWidths[i]);
+    }
+    return table;
+}
+
+std::string ColumnarTable::str(const RenderOptions& options) const {
+    std::string result;
+    BufferedWriter out(result);
+    render(out, options);
+    return result;
+}
+
+void ColumnarTable::renderTo(OutputSink& sink, const RenderOptions& options) const {
+    BufferedWriter out(sink);
+    render(out, options);
+    out.flush();
+}
+
+std::ostream& operator<<(std::ostream& os, const ColumnarTable& table) {
+    StreamSink sink(os);
+    table.renderTo(sink);
+    return os;
+}
+
+std::vector<size_t> ColumnarTable::calculateColumnWidths(std::optional<size_t> sampleRows) const {
+    const size_t columns = columnCount();
+    if (columns == 0) return {};
+
+    std::vector<size_t> widths(columns, 0);
+
+    if (m_header.has_value()) {
+        for (size_t i = 0; i < m_header->size() && i < columns; ++i) {
+            widths[i] = std::max(widths[i], maxLineWidth((*m_header)[i]));
+        }
+    }
+
+    // Each column is scanned front to back through its own arena
+    const size_t rows = std::min(sampleRows.value_or(m_rows), m_rows);
+    for (size_t i = 0; i < m_columns.size() && i < columns; ++i) {
+        const auto& column = m_columns[i];
+        const std::string_view arena = column.arena;
+        for (size_t r = 0; r < rows; ++r) {
+            const size_t begin = column.offsets[r];
+            widths[i] = std::max(widths[i], maxLineWidth(arena.substr(begin, column.offsets[r + 1] - begin)));
+        }
+    }
+
+    // Apply user-defined column widths
+    for (size_t i = 0; i < m_columnWidths.size() && i < columns; ++i) {
+        if (m_columnWidths[i].has_value()) {
+            widths[i] = m_columnWidths[i].value();
+        }
+    }
+
+    return widths;
+}
+
+void ColumnarTable::viewRow(size_t rowIndex, size_t firstColumn, std::span<CellView> cells) const {
+    for (size_t i = 0; i < cells.size(); ++i) {
+        cells[i] = {};
+        if (firstColumn + i < m_columns.size()) {
+            const auto& column = m_columns[firstColumn + i];
+            const size_t begin = column.offsets[rowIndex];
+            cells[i].text = std::string_view(column.arena).substr(begin, column.offsets[rowIndex + 1] - begin);
+        }
+    }
+}
+
+void ColumnarTable::writeRows(BufferedWriter& out, const Renderer& renderer, size_t firstColumn, size_t columns,
+                              size_t firstRow, size_t lastRow, bool endsTable) const {
+    std::vector<CellView> cells(columns);
+    const size_t lastColumn = firstColumn + columns;
+
+    // Alignment overrides are sorted by (row, column), so they are consumed in step with the rows
+    auto alignmentIt = m_cellAlignments.lower_bound({firstRow, 0});
+    for (size_t r = firstRow; r < lastRow; ++r) {
+        viewRow(r, firstColumn, cells);
+        for (; alignmentIt != m_cellAlignments.end() && alignmentIt->first.first == r; ++alignmentIt) {
+            const size_t column = alignmentIt->first.second;
+            if (column >= firstColumn && column < lastColumn) {
+                cells[column - firstColumn].alignment = alignmentIt->second;
+            }
+        }
+
+        renderer.writeRow(out, cells);
+        if (r < lastRow - 1 || !endsTable) {
+            renderer.writeRowSeparator(out);
+        }
+    }
+}
+
+void ColumnarTable::render(BufferedWriter& out, const RenderOptions& options) const {
+    if (empty()) {
+        return;
+    }
+
+    const Border& border = options.border.has_value() ? *options.border : m_border;
+
+    const auto allWidths = calculateColumnWidths(options.sampleRows);
+    const auto [firstColumn, columns] = clampRange(allWidths.size(), options.columnOffset, options.columnLimit);
+    if (columns == 0) {
+        return;
+    }
+    const std::span<const size_t> columnWidths = std::span(allWidths).subspan(firstColumn, columns);
+    const auto [firstAlignment, alignments] = clampRange(m_columnAlignments.size(), firstColumn, columns);
+    const std::span<const Alignment> columnAlignments = std::span(m_columnAlignments).subspan(firstAlignment, alignments);
+    const Renderer renderer(border, columnWidths, columnAlignments, options.overflow);
+
+    std::vector<CellView> headerCells(columns);
+    if (m_header.has_value()) {
+        for (size_t i = 0; i < columns; ++i) {
+            if (firstColumn + i < m_header->size()) {
+                headerCells[i].text = (*m_header)[firstColumn + i];
+            }
+        }
+    }
+
+    // Data rows are split into blocks that threads render independently
+    const auto [firstRow, rows] = clampRange(m_rows, options.rowOffset, options.rowLimit);
+    const size_t blockRows = std::max<size_t>(options.rowsPerBlock, 1);
+    const size_t blocks = (rows + blockRows - 1) / blockRows;
+    const unsigned threads = blocks > 1 ? static_cast<unsigned>(std::min<size_t>(resolveThreadCount(options.threads), blocks)) : 1;
+    auto blockBegin = [&](size_t index) { return firstRow + std::min(index * blockRows, rows); };
+
+    // Rendering into a string: size it exactly so the output is allocated once
+    if (out.direct()) {
+        std::vector<size_t> blockSizes(blocks);
+        parallelFor(blocks, threads, [&](size_t index) {
+            std::vector<CellView> cells(columns);
+            for (size_t r = blockBegin(index); r < blockBegin(index + 1); ++r) {
+                viewRow(r, firstColumn, cells);
+                blockSizes[index] += renderer.rowSize(cells);
+            }
+        });
+        size_t size = renderer.bordersSize(m_header.has_value(), rows);
+        if (m_header.has_value()) {
+            size += renderer.rowSize(headerCells);
+        }
+        out.reserve(std::accumulate(blockSizes.begin(), blockSizes.end(), size));
+    }
+
+    renderer.writeTop(out);
+
+    if (m_header.has_value()) {
+        renderer.writeRow(out, headerCells);
+        renderer.writeHeaderSeparator(out);
+    }
+
+    parallelWrite(out, blocks, threads, [&](size_t index, BufferedWriter& blockOut) {
+        const bool endsTable = index == blocks - 1;
+        if (threads == 1) {
+            writeRows(blockOut, renderer, firstColumn, columns, blockBegin(index), blockBegin(index + 1), endsTable);
+            return;
+        }
+        // Renderers keep scratch state, so blocks rendered concurrently get their own
+        const Renderer blockRenderer(border, columnWidths, columnAlignments, options.overflow);
+        writeRows(blockOut, blockRenderer, firstColumn, columns, blockBegin(index), blockBegin(index + 1), endsTable);
+    });
+
+    renderer.writeBottom(out);
+}
+
+} // namespace tabulix
@@ -0,0 +1,152 @@
+/**
+ * @file format.cpp
+ * @brief Implementation of numeric cell formatting
+ */
+
+#include "tabulix/core/format.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace tabulix {
+
+namespace {
+
+constexpr std::string_view kIntegerTypes = "dxXob";
+constexpr std::string_view kFloatingTypes = "feg";
+
+// Writes the sign character the spec asks for in front of a non-negative value
+char* writeSign(char* first, char* last, bool negative, const FormatSpec& spec) noexcept {
+    if (negative || spec.sign == '-') {
+        return first;
+    }
+    if (first == last) {
+        return nullptr;
+    }
+    *first = spec.sign;
+    return first + 1;
+}
+
+template <typename T>
+std::string_view formatInto(std::string& buffer, T value, const FormatSpec& spec) {
+    // Most numbers fit the small buffer; huge fixed-point values need to grow it
+    buffer.resize(std::max<size_t>(buffer.capacity(), 32));
+    while (true) {
+        if (const char* end = formatNumber(buffer.data(), buffer.data() + buffer.size(), value, spec)) {
+            return {buffer.data(), static_cast<size_t>(end - buffer.data())};
+        }
+        buffer.resize(buffer.size() * 2);
+    }
+}
+
+} // namespace
+
+FormatSpec FormatSpec::parse(std::string_view spec) {
+    FormatSpec result;
+    std::string_view rest = spec;
+
+    if (!rest.empty() && (rest.front() == '+' || rest.front() == '-' || rest.front() == ' ')) {
+        result.sign = rest.front();
+        rest.remove_prefix(1);
+    }
+
+    if (!rest.empty() && rest.front() == '.') {
+        rest.remove_prefix(1);
+        int precision = 0;
+        const auto [end, error] = std::from_chars(rest.data(), rest.data() + rest.size(), precision);
+        if (error != std::errc{} || precision < 0) {
+            throw std::invalid_argument("Invalid precision in format spec: " + std::string(spec));
+        }
+        result.precision = precision;
+        rest.remove_prefix(static_cast<size_t>(end - rest.data()));
+    }
+
+    if (!rest.empty()) {
+        result.type = rest.front();
+        rest.remove_prefix(1);
+        if (kIntegerTypes.find(result.type) == std::string_view::npos
+            && kFloatingTypes.find(result.type) == std::string_view::npos) {
+            throw std::invalid_argument("Unsupported type in format spec: " + std::string(spec));
+        }
+    }
+
+    if (!rest.empty()) {
+        throw std::invalid_argument("Unsupported format spec: " + std::string(spec));
+    }
+    return result;
+}
+
+char* formatNumber(char* first, char* last, int64_t value, const FormatSpec& spec) noexcept {
+    if (kFloatingTypes.find(spec.type) != std::string_view::npos) {
+        return formatNumber(first, last, static_cast<double>(value), spec);
+    }
+
+    first = writeSign(first, last, value < 0, spec);
+    if (first == nullptr) {
+        return nullptr;
+    }
+
+    int base = 10;
+    switch (spec.type) {
+        case 'x':
+        case 'X':
+            base = 16;
+            break;
+        case 'o':
+            base = 8;
+            break;
+        case 'b':
+            base = 2;
+            break;
+        default:
+            break;
+    }
+
+    const auto [end, error] = std::to_chars(first, last, value, base);
+    if (error != std::errc{}) {
+        return nullptr;
+    }
+    if (spec.type == 'X') {
+        std::transform(first, end, first, [](char c) { return static_cast<char>(std::toupper(c)); });
+    }
+    return end;
+}
+
+char* formatNumber(char* first, char* last, double value, const FormatSpec& spec) noexcept {
+    first = writeSign(first, last, std::signbit(value), spec);
+    if (first == nullptr) {
+        return nullptr;
+    }
+
+    std::to_chars_result result{};
+    switch (spec.type) {
+        case 'f':
+            result = std::to_chars(first, last, value, std::chars_format::fixed, spec.precision.value_or(6));
+            break;
+        case 'e':
+            result = std::to_chars(first, last, value, std::chars_format::scientific, spec.precision.value_or(6));
+            break;
+        case 'g':
+            result = std::to_chars(first, last, value, std::chars_format::general, spec.precision.value_or(6));
+            break;
+        default:
+            result = spec.precision.has_value()
+                ? std::to_chars(first, last, value, std::chars_format::general, *spec.precision)
+                : std::to_chars(first, last, value);
+            break;
+    }
+    return result.ec == std::errc{} ? result.ptr : nullptr;
+}
+
+std::string_view formatNumber(std::string& buffer, int64_t value, const FormatSpec& spec) {
+    return formatInto(buffer, value, spec);
+}
+
+std::string_view formatNumber(std::string& buffer, double value, const FormatSpec& spec) {
+    return formatInto(buffer, value, spec);
+}
+
+} // namespace tabulix
@@ -0,0 +1,244 @@
+/**
+ * @file live_table.cpp
+ * @brief Implementation of the LiveTable class
+ */
+
+#include "tabulix/core/live_table.hpp"
+#include "tabulix/core/text.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace tabulix {
+
+namespace {
+
+// Lines written to a frame since a given size of it
+size_t linesSince(const std::string& frame, size_t start) noexcept {
+    return countNewlines(std::string_view(frame).substr(start));
+}
+
+// Puts an erase-to-end-of-line before every newline of a frame from a given offset,
+// so that lines drawn over longer ones leave nothing of them behind
+void eraseLineEnds(std::string& frame, size_t start) {
+    static constexpr std::string_view kEraseLine = "\x1b[K";
+    const size_t lines = linesSince(frame, start);
+    size_t src = frame.size();
+    frame.resize(frame.size() + lines * kEraseLine.size());
+
+    // Shift the lines back from the end so the frame is grown in place
+    size_t dst = frame.size();
+    while (src > start) {
+        const char c = frame[--src];
+        frame[--dst] = c;
+        if (c == '\n') {
+            dst -= kEraseLine.size();
+            kEraseLine.copy(frame.data() + dst, kEraseLine.size());
+        }
+    }
+}
+
+} // namespace
+
+LiveTable::LiveTable(Table table) : m_table(std::move(table)) {
+}
+
+const Table& LiveTable::table() const noexcept {
+    return m_table;
+}
+
+LiveTable& LiveTable::addRow(std::initializer_list<std::string> cells) {
+    m_table.addRow(cells);
+    return *this;
+}
+
+LiveTable& LiveTable::addRow(const Row& row) {
+    m_table.addRow(row);
+    return *this;
+}
+
+LiveTable& LiveTable::addRow(Row&& row) {
+    m_table.addRow(std::move(row));
+    return *this;
+}
+
+LiveTable& LiveTable::setValue(size_t rowIndex, size_t columnIndex, std::string_view value) {
+    m_table.setValue(rowIndex, columnIndex, value);
+
+    // Rows appended since the last redraw are drawn in full anyway
+    if (rowIndex < m_dirty.size()) {
+        m_dirty[rowIndex] = true;
+    }
+    return *this;
+}
+
+LiveTable& LiveTable::setTheme(Theme theme) {
+    m_table.setTheme(theme);
+    m_layoutChanged = true;
+    return *this;
+}
+
+LiveTable& LiveTable::setColumnAlignment(size_t columnIndex, Alignment alignment) {
+    m_table.setColumnAlignment(columnIndex, alignment);
+    m_layoutChanged = true;
+    return *this;
+}
+
+LiveTable& LiveTable::setColumnFormat(size_t columnIndex, std::string_view spec) {
+    m_table.setColumnFormat(columnIndex, spec);
+    m_layoutChanged = true;
+    return *this;
+}
+
+void LiveTable::invalidate() noexcept {
+    m_drawn = false;
+    m_lines = 0;
+    m_dirty.clear();
+}
+
+void LiveTable::redraw(OutputSink& sink) {
+    if (m_table.empty()) {
+        return;
+    }
+
+    m_frame.clear();
+    m_cursor = m_lines;
+    BufferedWriter out(m_frame);
+
+    // Widths never shrink while live: only a growing column forces a full redraw
+    const auto widths = m_table.columnWidths();
+    bool full = !m_drawn || m_layoutChanged || widths.size() != m_widths.size();
+    for (size_t i = 0; !full && i < widths.size(); ++i) {
+        full = widths[i] > m_widths[i];
+    }
+    if (full && !m_drawn) {
+        m_widths = widths;
+    } else if (full) {
+        m_widths.resize(widths.size());
+        for (size_t i = 0; i < widths.size(); ++i) {
+            m_widths[i] = std::max(m_widths[i], widths[i]);
+        }
+    }
+
+    const size_t columns = m_widths.size();
+    m_alignments.resize(columns);
+    for (size_t i = 0; i < columns; ++i) {
+        m_alignments[i] = m_table.columnAlignment(i);
+    }
+    m_cells.resize(columns);
+    m_numbers.resize(columns);
+    const Renderer renderer(m_table.border(), m_widths, m_alignments);
+    const auto rows = m_table.rows();
+
+    if (full) {
+        moveTo(out, 0);
+        const size_t start = m_frame.size();
+        renderer.writeTop(out);
+        if (m_table.header().has_value()) {
+            renderer.writeRow(out, viewRow(*m_table.header()));
+            renderer.writeHeaderSeparator(out);
+        }
+        m_cursor += linesSince(m_frame, start);
+        m_bodyStart = m_cursor;
+        drawFrom(out, renderer, 0);
+
+        // Lines drawn over the previous frame may be shorter, e.g. after a theme change
+        if (m_drawn) {
+            eraseLineEnds(m_frame, start);
+        }
+    } else {
+        // Lines keep their widths, so rewriting them in place covers the old text
+        // Rewrite changed rows in place until one changes height and shifts the rest
+        const size_t drawnRows = m_dirty.size();
+        size_t tail = drawnRows;
+        bool reflow = rows.size() > drawnRows;
+        for (size_t r = 0; r < drawnRows; ++r) {
+            if (!m_dirty[r]) {
+                continue;
+            }
+            moveTo(out, m_rowStarts[r]);
+            const size_t lines = writeRow(out, renderer, rows[r]);
+            if (lines != m_rowLines[r]) {
+                m_rowLines[r] = lines;
+                tail = r + 1;
+                reflow = true;
+                break;
+            }
+        }
+        if (reflow) {
+            drawFrom(out, renderer, tail);
+        }
+    }
+
+    moveTo(out, m_lines);
+    m_dirty.assign(rows.size(), false);
+    m_drawn = true;
+    m_layoutChanged = false;
+
+    if (!m_frame.empty()) {
+        sink.write(m_frame);
+        sink.flush();
+    }
+}
+
+std::span<const CellView> LiveTable::viewRow(const Row& row) {
+    for (size_t i = 0; i < m_cells.size(); ++i) {
+        if (i < row.size()) {
+            m_cells[i] = {row.at(i).format(m_numbers[i], m_table.columnFormat(i)), row.at(i).alignment()};
+        } else {
+            m_cells[i] = {};
+        }
+    }
+    return m_cells;
+}
+
+size_t LiveTable::writeRow(BufferedWriter& out, const Renderer& renderer, const Row& row) {
+    const size_t start = m_frame.size();
+    renderer.writeRow(out, viewRow(row));
+    const size_t lines = linesSince(m_frame, start);
+    m_cursor += lines;
+    return lines;
+}
+
+void LiveTable::drawFrom(BufferedWriter& out, const Renderer& renderer, size_t first) {
+    const auto rows = m_table.rows();
+    moveTo(out, first == 0 ? m_bodyStart : m_rowStarts[first - 1] + m_rowLines[first - 1]);
+
+    m_rowStarts.resize(rows.size());
+    m_rowLines.resize(rows.size());
+    for (size_t r = first; r < rows.size(); ++r) {
+        if (r > 0) {
+            const size_t start = m_frame.size();
+            renderer.writeRowSeparator(out);
+            m_cursor += linesSince(m_frame, start);
+        }
+        m_rowStarts[r] = m_cursor;
+        m_rowLines[r] = writeRow(out, renderer, rows[r]);
+    }
+
+    const size_t start = m_frame.size();
+    renderer.writeBottom(out);
+    m_cursor += linesSince(m_frame, start);
+
+    // Erase whatever a previously taller table left below
+    if (m_cursor < m_lines) {
+        out.write("\x1b[J");
+    }
+    m_lines = m_cursor;
+}
+
+void LiveTable::moveTo(BufferedWriter& out, size_t line) {
+    if (line == m_cursor) {
+        return;
+    }
+
+    // CPL/CNL: move up or down a number of lines, to the first column
+    const bool up = line < m_cursor;
+    char distance[24];
+    const auto result = std::to_chars(distance, distance + sizeof(distance), up ? m_cursor - line : line - m_cursor);
+    out.write("\x1b[");
+    out.write(std::string_view(distance, static_cast<size_t>(result.ptr - distance)));
+    out.write(up ? "F" : "E");
+    m_cursor = line;
+}
+
+} // namespace tabulix
@@ -0,0 +1,250 @@
+/**
+ * @file parallel.cpp
+ * @brief Implementation of the fork-join helpers
+ */
+
+#include "tabulix/core/parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tabulix {
+
+namespace {
+
+/**
+ * @brief One parallelFor call: the indices left to run and the threads running them
+ */
+struct Job {
+    const std::function<void(size_t)>& task;
+    const size_t count;
+    size_t helpers;   // Workers still wanted, guarded by the pool mutex
+    size_t active = 0; // Workers inside work(), guarded by the pool mutex
+    std::atomic<size_t> next = 0;
+    std::mutex errorMutex{};
+    std::exception_ptr error{};
+
+    // Claim and run indices until none are left; after a failure the remaining ones are skipped
+    void work() noexcept {
+        for (size_t i = next++; i < count; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Worker threads shared by every parallelFor call of the process
+ *
+ * Workers are started the first time a call needs them and then wait for the
+ * next call, so a call only pays for waking them up. Idle workers join the
+ * oldest job that still wants helpers; a job never waits for a worker, since
+ * the calling thread runs whatever indices nobody else claimed.
+ */
+class WorkerPool {
+public:
+    static WorkerPool& instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+    }
+
+    void run(size_t count, size_t helpers, const std::function<void(size_t)>& task) {
+        Job job{task, count, helpers};
+        {
+            std::lock_guard lock(m_mutex);
+            while (m_workers.size() < helpers) {
+                m_workers.emplace_back([this] { workLoop(); });
+            }
+            m_jobs.push_back(&job);
+        }
+        for (size_t i = 0; i < helpers; ++i) {
+            m_wake.notify_one();
+        }
+
+        job.work();
+
+        {
+            std::unique_lock lock(m_mutex);
+            std::erase(m_jobs, &job);
+            m_done.wait(lock, [&] { return job.active == 0; });
+        }
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::deque<Job*> m_jobs;
+    bool m_stopping = false;
+    // Declared last so the threads are joined before the state they use is destroyed
+    std::vector<std::jthread> m_workers;
+
+    WorkerPool() = default;
+
+    void workLoop() {
+        std::unique_lock lock(m_mutex);
+        while (true) {
+            m_wake.wait(lock, [&] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            Job& job = *m_jobs.front();
+            if (--job.helpers == 0) {
+                m_jobs.pop_front();
+            }
+            ++job.active;
+            lock.unlock();
+            job.work();
+            lock.lock();
+            if (--job.active == 0) {
+                m_done.notify_all();
+            }
+        }
+    }
+};
+
+/**
+ * @brief Hands blocks rendered on several threads to the output in order
+ *
+ * At most a fixed number of rendered blocks are held. Whichever thread
+ * completes the next block due writes it, and any following blocks that
+ * are ready, while the other threads go on rendering.
+ */
+class OrderedBlocks {
+public:
+    OrderedBlocks(BufferedWriter& out, size_t slots)
+        : m_out(out)
+        , m_buffers(slots)
+        , m_ready(slots, false) {
+    }
+
+    // Waits until a block may take its buffer; returns nullptr once another block failed
+    std::string* acquire(size_t index) {
+        std::unique_lock lock(m_mutex);
+        m_written.wait(lock, [&] { return m_failed || index < m_next + m_buffers.size(); });
+        if (m_failed) {
+            return nullptr;
+        }
+        std::string& buffer = m_buffers[index % m_buffers.size()];
+        buffer.clear();
+        return &buffer;
+    }
+
+    // Marks a block as rendered and writes every block now due unless another thread is already writing
+    void complete(size_t index) {
+        std::unique_lock lock(m_mutex);
+        m_ready[index % m_buffers.size()] = true;
+        if (m_writing) {
+            return;
+        }
+        m_writing = true;
+        while (!m_failed && m_ready[m_next % m_buffers.size()]) {
+            const size_t slot = m_next % m_buffers.size();
+            lock.unlock();
+            try {
+                m_out.write(m_buffers[slot]);
+            } catch (...) {
+                lock.lock();
+                m_writing = false;
+                throw;
+            }
+            lock.lock();
+            m_ready[slot] = false;
+            ++m_next;
+            m_written.notify_all();
+        }
+        m_writing = false;
+    }
+
+    // Releases the threads waiting for a buffer after a block failed to render or write
+    void fail() noexcept {
+        {
+            std::lock_guard lock(m_mutex);
+            m_failed = true;
+        }
+        m_written.notify_all();
+    }
+
+private:
+    BufferedWriter& m_out;
+    std::vector<std::string> m_buffers;
+    std::vector<bool> m_ready;
+    std::mutex m_mutex;
+    std::condition_variable m_written;
+    size_t m_next = 0;
+    bool m_writing = false;
+    bool m_failed = false;
+};
+
+} // namespace
+
+unsigned resolveThreadCount(unsigned threads) noexcept {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return std::max(threads, 1u);
+}
+
+void parallelFor(size_t count, unsigned threads, const std::function<void(size_t)>& task) {
+    const size_t workers = std::min<size_t>(resolveThreadCount(threads), count);
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+    WorkerPool::instance().run(count, workers - 1, task);
+}
+
+void parallelWrite(BufferedWriter& out, size_t blocks, unsigned threads,
+                   const std::function<void(size_t, BufferedWriter&)>& render) {
+    const size_t workers = std::min<size_t>(resolveThreadCount(threads), blocks);
+    if (workers <= 1) {
+        for (size_t i = 0; i < blocks; ++i) {
+            render(i, out);
+        }
+        return;
+    }
+
+    OrderedBlocks ordered(out, 2 * workers);
+    parallelFor(blocks, static_cast<unsigned>(workers), [&](size_t index) {
+        try {
+            std::string* buffer = ordered.acquire(index);
+            if (buffer == nullptr) {
+                return;
+            }
+            BufferedWriter blockOut(*buffer);
+            render(index, blockOut);
+            ordered.complete(index);
+        } catch (...) {
+            ordered.fail();
+            throw;
+        }
+    });
+}
+
+} // namespace tabulix
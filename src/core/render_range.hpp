@@ -0,0 +1,31 @@
+/**
+ * @file render_range.hpp
+ * @brief Clamping of the row and column ranges of RenderOptions (internal, not installed)
+ */
+
+#ifndef TABULIX_SRC_CORE_RENDER_RANGE_HPP
+#define TABULIX_SRC_CORE_RENDER_RANGE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace tabulix {
+
+/**
+ * @brief Clamp an offset/limit pair to a sequence of the given size
+ * @param size Number of elements in the sequence
+ * @param offset Index of the first element requested
+ * @param limit Maximum number of elements requested (all remaining if unset)
+ * @return Index of the first element and number of elements, both within the sequence
+ */
+[[nodiscard]] inline std::pair<size_t, size_t> clampRange(size_t size, size_t offset,
+                                                          std::optional<size_t> limit) noexcept {
+    const size_t first = std::min(offset, size);
+    return {first, std::min(limit.value_or(size), size - first)};
+}
+
+} // namespace tabulix
+
+#endif // TABULIX_SRC_CORE_RENDER_RANGE_HPP
@@ -0,0 +1,213 @@
+/**
+ * @file renderer.cpp
+ * @brief Implementation of the Renderer class
+ */
+
+#include "tabulix/core/renderer.hpp"
+#include "tabulix/core/text.hpp"
+#include "tabulix/core/width.hpp"
+#include <algorithm>
+
+namespace tabulix {
+
+Renderer::Renderer(const Border& border,
+                   std::span<const size_t> columnWidths,
+                   std::span<const Alignment> columnAlignments,
+                   Overflow overflow)
+    : m_border(border)
+    , m_columnWidths(columnWidths)
+    , m_columnAlignments(columnAlignments)
+    , m_overflow(overflow)
+    , m_remaining(columnWidths.size()) {
+    // Every content line: edges, one separator between columns, padded cells and a newline
+    const size_t columns = m_columnWidths.size();
+    m_lineSize = 1;
+    if (m_border.enabled()) {
+        m_lineSize += m_border.vertical().size() * (columns > 0 ? columns + 1 : 2);
+    }
+    for (const size_t width : m_columnWidths) {
+        m_lineSize += width + 2;
+    }
+
+    m_topLine = buildLine(m_border.topLeft(), m_border.topIntersection(), m_border.topRight());
+    m_separatorLine = buildLine(m_border.leftIntersection(), m_border.crossIntersection(), m_border.rightIntersection());
+    m_bottomLine = buildLine(m_border.bottomLeft(), m_border.bottomIntersection(), m_border.bottomRight());
+}
+
+void Renderer::writeTop(BufferedWriter& out) const {
+    out.write(m_topLine);
+}
+
+void Renderer::writeHeaderSeparator(BufferedWriter& out) const {
+    out.write(m_separatorLine);
+}
+
+void Renderer::writeRowSeparator(BufferedWriter& out) const {
+    out.write(m_separatorLine);
+}
+
+void Renderer::writeBottom(BufferedWriter& out) const {
+    out.write(m_bottomLine);
+}
+
+std::string Renderer::buildLine(std::string_view left,
+                                std::string_view intersection,
+                                std::string_view right) const {
+    if (!m_border.enabled()) {
+        return {};
+    }
+
+    // The horizontal glyph may be several bytes long (e.g. UTF-8 box drawing)
+    const std::string_view horizontal = m_border.horizontal();
+    const size_t columns = m_columnWidths.size();
+
+    std::string line;
+    line.append(left);
+    for (size_t i = 0; i < columns; ++i) {
+        for (size_t n = 0; n < m_columnWidths[i] + 2; ++n) {
+            line.append(horizontal);
+        }
+        if (i < columns - 1) {
+            line.append(intersection);
+        }
+    }
+    line.append(right);
+    line.append("\n");
+    return line;
+}
+
+FittedText Renderer::nextSegment(std::string_view& text, size_t width) const noexcept {
+    if (m_overflow == Overflow::WRAP) {
+        const size_t newline = findNewline(text);
+        const std::string_view line = text.substr(0, newline);
+        const auto fitted = fitToWidth(line, width);
+
+        // Wrap at a character boundary; a character wider than the column is cut instead
+        if (!fitted.text.empty() && fitted.text.size() < line.size()) {
+            text.remove_prefix(fitted.text.size());
+        } else {
+            (void)nextLine(text);
+        }
+        return fitted;
+    }
+
+    // Truncate to the column width at a character boundary
+    return fitToWidth(nextLine(text), width);
+}
+
+void Renderer::writePadded(BufferedWriter& out, const FittedText& fitted, size_t width, Alignment align) {
+    // Pad by display width, not by bytes
+    const std::string_view text = fitted.text;
+    const size_t padding = width - fitted.width;
+    if (padding == 0) {
+        out.write(text);
+        return;
+    }
+
+    switch (align) {
+        case Alignment::RIGHT: {
+            out.write(padding, ' ');
+            out.write(text);
+            break;
+        }
+        case Alignment::CENTER: {
+            const size_t leftPad = padding / 2;
+            out.write(leftPad, ' ');
+            out.write(text);
+            out.write(padding - leftPad, ' ');
+            break;
+        }
+        case Alignment::LEFT:
+        default: {
+            out.write(text);
+            out.write(padding, ' ');
+            break;
+        }
+    }
+}
+
+size_t Renderer::rowLines(std::span<const CellView> cells) const noexcept {
+    const size_t columns = std::min(m_columnWidths.size(), cells.size());
+    size_t lines = 1;
+    for (size_t i = 0; i < columns; ++i) {
+        if (m_overflow == Overflow::WRAP) {
+            // Wrapped lines depend on the width of every line: count them as they are written
+            std::string_view text = cells[i].text;
+            size_t cellLines = 0;
+            do {
+                (void)nextSegment(text, m_columnWidths[i]);
+                ++cellLines;
+            } while (!text.empty());
+            lines = std::max(lines, cellLines);
+        } else {
+            lines = std::max(lines, countLines(cells[i].text));
+        }
+    }
+    return lines;
+}
+
+void Renderer::writeRow(BufferedWriter& out, std::span<const CellView> cells) const {
+    const size_t columns = m_columnWidths.size();
+    const bool hasBorder = m_border.enabled();
+    const size_t lines = rowLines(cells);
+
+    // Each rendered line consumes one line of every cell; exhausted cells render blank
+    for (size_t i = 0; i < columns; ++i) {
+        m_remaining[i] = i < cells.size() ? cells[i].text : std::string_view{};
+    }
+
+    for (size_t lineIdx = 0; lineIdx < lines; ++lineIdx) {
+        if (hasBorder) {
+            out.write(m_border.vertical());
+        }
+
+        for (size_t i = 0; i < columns; ++i) {
+            const auto columnAlign = i < m_columnAlignments.size() ? m_columnAlignments[i] : Alignment::LEFT;
+            const auto align = i < cells.size() ? cells[i].alignment.value_or(columnAlign) : columnAlign;
+
+            out.write(" ");
+            writePadded(out, nextSegment(m_remaining[i], m_columnWidths[i]), m_columnWidths[i], align);
+            out.write(" ");
+
+            if (hasBorder && i < columns - 1) {
+                out.write(m_border.vertical());
+            }
+        }
+
+        if (hasBorder) {
+            out.write(m_border.vertical());
+        }
+        out.write("\n");
+    }
+}
+
+size_t Renderer::rowSize(std::span<const CellView> cells) const noexcept {
+    size_t size = rowLines(cells) * m_lineSize;
+
+    // Multi-byte characters take more bytes than the columns they occupy
+    const size_t columns = std::min(m_columnWidths.size(), cells.size());
+    for (size_t i = 0; i < columns; ++i) {
+        std::string_view text = cells[i].text;
+        if (asciiPrefixLength(text) == text.size()) {
+            continue;
+        }
+        do {
+            const auto fitted = nextSegment(text, m_columnWidths[i]);
+            size += fitted.text.size() - fitted.width;
+        } while (!text.empty());
+    }
+    return size;
+}
+
+size_t Renderer::bordersSize(bool hasHeader, size_t rows) const noexcept {
+    size_t size = m_topLine.size() + m_bottomLine.size();
+    if (hasHeader) {
+        size += m_separatorLine.size();
+    }
+    if (rows > 1) {
+        size += m_separatorLine.size() * (rows - 1);
+    }
+    return size;
+}
+
+} // namespace tabulix
@@ -8,19 +8,35 @@
 
 namespace tabulix {
 
-Row::Row(const std::vector<std::string>& cells) {
+Row::Row(const allocator_type& alloc) noexcept : m_cells(alloc) {
+}
+
+Row::Row(const std::vector<std::string>& cells, const allocator_type& alloc) : m_cells(alloc) {
+    m_cells.reserve(cells.size());
     for (const auto& cell : cells) {
         addCell(cell);
     }
 }
 
-Row::Row(std::initializer_list<std::string> cells) {
+Row::Row(std::initializer_list<std::string> cells, const allocator_type& alloc) : m_cells(alloc) {
+    m_cells.reserve(cells.size());
     for (const auto& cell : cells) {
         addCell(cell);
     }
 }
 
-Row& Row::addCell(const std::string& value) {
+Row::Row(const Row& other, const allocator_type& alloc) : m_cells(other.m_cells, alloc) {
+}
+
+Row::Row(Row&& other, const allocator_type& alloc) : m_cells(std::move(other.m_cells), alloc) {
+}
+
+Row::allocator_type Row::get_allocator() const noexcept {
+    return m_cells.get_allocator();
+}
+
+Row& Row::addCell(std::string_view value) {
+    // The vector passes its allocator on to the new cell
     m_cells.emplace_back(value);
     return *this;
 }
@@ -30,6 +46,16 @@ Row& Row::addCell(const Cell& cell) {
     return *this;
 }
 
+Row& Row::addCell(Cell&& cell) {
+    m_cells.push_back(std::move(cell));
+    return *this;
+}
+
+Row& Row::reserve(size_t cells) {
+    m_cells.reserve(cells);
+    return *this;
+}
+
 size_t Row::size() const noexcept {
     return m_cells.size();
 }
@@ -50,7 +76,7 @@ Cell& Row::operator[](size_t index) {
     return at(index);
 }
 
-const std::vector<Cell>& Row::cells() const noexcept {
+std::span<const Cell> Row::cells() const noexcept {
     return m_cells;
 }
 
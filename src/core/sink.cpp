@@ -0,0 +1,118 @@
+/**
+ * @file sink.cpp
+ * @brief Implementation of output sinks and the chunked writer
+ */
+
+#include "tabulix/core/sink.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace tabulix {
+
+size_t OutputSink::preferredChunkSize() const noexcept {
+    return BufferedWriter::kDefaultCapacity;
+}
+
+StringSink::StringSink(std::string& target) noexcept : m_target(target) {
+}
+
+void StringSink::write(std::string_view data) {
+    m_target.append(data);
+}
+
+StreamSink::StreamSink(std::ostream& stream) noexcept : m_stream(stream) {
+}
+
+void StreamSink::write(std::string_view data) {
+    m_stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void StreamSink::flush() {
+    m_stream.flush();
+}
+
+FileDescriptorSink::FileDescriptorSink(int fd) noexcept : m_fd(fd) {
+}
+
+void FileDescriptorSink::write(std::string_view data) {
+    const char* ptr = data.data();
+    size_t remaining = data.size();
+
+    // write(2) may accept fewer bytes than requested, so loop until done
+    while (remaining > 0) {
+#if defined(_WIN32)
+        const auto written = ::_write(m_fd, ptr, static_cast<unsigned int>(remaining));
+#else
+        const auto written = ::write(m_fd, ptr, remaining);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "write");
+        }
+        ptr += written;
+        remaining -= static_cast<size_t>(written);
+        m_bytesWritten += static_cast<size_t>(written);
+    }
+}
+
+size_t FileDescriptorSink::preferredChunkSize() const noexcept {
+    return kChunkSize;
+}
+
+size_t FileDescriptorSink::bytesWritten() const noexcept {
+    return m_bytesWritten;
+}
+
+CallbackSink::CallbackSink(Callback callback) : m_callback(std::move(callback)) {
+}
+
+void CallbackSink::write(std::string_view data) {
+    m_callback(data);
+}
+
+BufferedWriter::BufferedWriter(OutputSink& sink) : BufferedWriter(sink, sink.preferredChunkSize()) {
+}
+
+BufferedWriter::BufferedWriter(OutputSink& sink, size_t capacity)
+    : m_sink(&sink)
+    , m_buffer(&m_ownBuffer)
+    , m_capacity(std::max<size_t>(capacity, 1)) {
+    m_ownBuffer.reserve(m_capacity);
+}
+
+BufferedWriter::BufferedWriter(std::string& target) noexcept
+    : m_sink(nullptr)
+    , m_buffer(&target)
+    , m_capacity(std::numeric_limits<size_t>::max()) {
+}
+
+void BufferedWriter::flush() {
+    // Writers over a string have no sink: their output is already in place
+    if (m_sink != nullptr && !m_buffer->empty()) {
+        m_sink->write(*m_buffer);
+        m_buffer->clear();
+    }
+}
+
+bool BufferedWriter::direct() const noexcept {
+    return m_sink == nullptr;
+}
+
+void BufferedWriter::reserve(size_t size) {
+    // Chunked writers never hold more than their capacity
+    if (direct()) {
+        m_buffer->reserve(m_buffer->size() + size);
+    }
+}
+
+} // namespace tabulix
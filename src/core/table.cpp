@@ -4,28 +4,204 @@
  */
 
 #include "tabulix/core/table.hpp"
+#include "tabulix/core/parallel.hpp"
+#include "tabulix/core/renderer.hpp"
+#include "tabulix/core/text.hpp"
 #include "tabulix/styling/theme.hpp"
+#include "render_range.hpp"
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
-#include <sstream>
+#include <utility>
 
 namespace tabulix {
 
-Table::Table(const std::vector<std::string>& headers) {
+namespace {
+
+/**
+ * @brief Reusable cell views of the row currently being rendered
+ */
+class RowViews {
+public:
+    RowViews(const Table& table, size_t firstColumn, size_t columns)
+        : m_table(table)
+        , m_firstColumn(firstColumn)
+        , m_cells(columns)
+        , m_numbers(columns) {
+    }
+
+    std::span<const CellView> operator()(const Row& row) {
+        for (size_t i = 0; i < m_cells.size(); ++i) {
+            const size_t column = m_firstColumn + i;
+            if (column < row.size()) {
+                // Numeric cells are formatted here, into per-column scratch buffers
+                m_cells[i] = {row.at(column).format(m_numbers[i], m_table.columnFormat(column)),
+                              row.at(column).alignment()};
+            } else {
+                m_cells[i] = {};
+            }
+        }
+        return m_cells;
+    }
+
+private:
+    const Table& m_table;
+    size_t m_firstColumn;
+    std::vector<CellView> m_cells;
+    std::vector<std::string> m_numbers;
+};
+
+size_t rowsSize(const Renderer& renderer, RowViews& views, std::span<const Row> rows) {
+    size_t size = 0;
+    for (const auto& row : rows) {
+        size += renderer.rowSize(views(row));
+    }
+    return size;
+}
+
+// Writes rows with separators between them, and after the last one unless it ends the table
+void writeRows(BufferedWriter& out, const Renderer& renderer, RowViews& views,
+               std::span<const Row> rows, bool endsTable) {
+    for (size_t rowIdx = 0; rowIdx < rows.size(); ++rowIdx) {
+        renderer.writeRow(out, views(rows[rowIdx]));
+        if (rowIdx < rows.size() - 1 || !endsTable) {
+            renderer.writeRowSeparator(out);
+        }
+    }
+}
+
+/**
+ * @brief Sort key of a row
+ *
+ * The prefix preserves the order of the values it is made from, so most
+ * comparisons only compare integers.
+ */
+struct RowKey {
+    std::array<uint64_t, 2> prefix;
+    uint32_t row;
+    uint32_t flags;
+};
+
+// The row has no value to sort by and goes last
+constexpr uint32_t kMissingValue = 1;
+// The prefix does not identify the text, so equal prefixes compare the full text: the text
+// is longer than the prefix, or holds NUL bytes that its zero padding cannot be told from
+constexpr uint32_t kLongText = 2;
+// The number is at least 2^63, larger than every int64_t with the same prefix
+constexpr uint32_t kPastInt64 = 4;
+constexpr size_t kPrefixBytes = sizeof(RowKey::prefix);
+
+// First bytes of a text as big-endian integers: integer order is byte-wise text order
+std::array<uint64_t, 2> textPrefix(std::string_view text) noexcept {
+    std::array<uint64_t, 2> prefix{};
+    std::memcpy(prefix.data(), text.data(), std::min(text.size(), kPrefixBytes));
+    if constexpr (std::endian::native == std::endian::little) {
+        prefix[0] = std::byteswap(prefix[0]);
+        prefix[1] = std::byteswap(prefix[1]);
+    }
+    return prefix;
+}
+
+constexpr uint64_t kSignBit = uint64_t{1} << 63;
+
+// Maps doubles to integers of the same order: flip negative numbers, set the sign bit of the others
+uint64_t numberPrefix(double value) noexcept {
+    const auto bits = std::bit_cast<uint64_t>(value == 0.0 ? 0.0 : value);
+    return (bits & kSignBit) != 0 ? ~bits : bits | kSignBit;
+}
+
+// Key of a number: the double image, then the exact integer value for numbers beyond 2^53 that round together
+RowKey numberKey(const Cell::Number& number, uint32_t index) noexcept {
+    if (const auto* integer = std::get_if<int64_t>(&number)) {
+        return {{numberPrefix(static_cast<double>(*integer)), static_cast<uint64_t>(*integer) ^ kSignBit}, index, 0};
+    }
+
+    const double value = std::get<double>(number);
+    if (std::isnan(value)) {
+        return {{}, index, kMissingValue};
+    }
+    // 2^63 is the double INT64_MAX rounds to, but it is larger
+    if (value >= 0x1p63) {
+        return {{numberPrefix(value), std::numeric_limits<uint64_t>::max()}, index, kPastInt64};
+    }
+    // Doubles this large are integers; smaller ones share no image with a different integer
+    const uint64_t exact = value < -0x1p63 ? 0 : static_cast<uint64_t>(static_cast<int64_t>(value)) ^ kSignBit;
+    return {{numberPrefix(value), exact}, index, 0};
+}
+
+// Parses a whole text cell as a number, allowing surrounding blanks and a leading '+'
+std::optional<Cell::Number> parseNumber(std::string_view text) noexcept {
+    const size_t first = text.find_first_not_of(" \t");
+    if (first == std::string_view::npos) {
+        return std::nullopt;
+    }
+    text = text.substr(first, text.find_last_not_of(" \t") - first + 1);
+    if (text.starts_with('+')) {
+        text.remove_prefix(1);
+    }
+    const char* end = text.data() + text.size();
+
+    // Integers first, so large ones keep every digit
+    int64_t integer = 0;
+    if (const auto result = std::from_chars(text.data(), end, integer); result.ec == std::errc() && result.ptr == end) {
+        return integer;
+    }
+    double value = 0;
+    if (const auto result = std::from_chars(text.data(), end, value); result.ec == std::errc() && result.ptr == end) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+RowKey makeKey(const Row& row, size_t column, uint32_t index, SortKey key, const FormatSpec& format,
+               std::string& buffer) {
+    if (column >= row.size()) {
+        return {{}, index, kMissingValue};
+    }
+    const Cell& cell = row.at(column);
+
+    if (key == SortKey::NUMERIC) {
+        const auto number = cell.isNumeric() ? cell.number() : parseNumber(cell.value());
+        return number.has_value() ? numberKey(*number, index) : RowKey{{}, index, kMissingValue};
+    }
+
+    const std::string_view text = cell.format(buffer, format);
+    const bool partial = text.size() > kPrefixBytes || text.find('\0') != std::string_view::npos;
+    return {textPrefix(text), index, partial ? kLongText : 0};
+}
+
+} // namespace
+
+Table::Table(const allocator_type& alloc) noexcept : m_rows(alloc) {
+}
+
+Table::Table(const std::vector<std::string>& headers, const allocator_type& alloc) : m_rows(alloc) {
     addHeader(headers);
 }
 
-Table::Table(std::initializer_list<std::string> headers) {
+Table::Table(std::initializer_list<std::string> headers, const allocator_type& alloc) : m_rows(alloc) {
     addHeader(headers);
 }
 
+Table::allocator_type Table::get_allocator() const noexcept {
+    return m_rows.get_allocator();
+}
+
 Table& Table::addHeader(const std::vector<std::string>& headers) {
-    Row row;
-    for (const auto& header : headers) {
-        row.addCell(header);
+    const Row& row = m_header.emplace(headers, get_allocator());
+
+    m_headerWidths.assign(row.size(), 0);
+    for (size_t i = 0; i < row.size(); ++i) {
+        m_headerWidths[i] = row.at(i).width(columnFormat(i));
     }
-    m_header = row;
 
     // Ensure column alignments and widths are initialized
     if (m_columnAlignments.size() < row.size()) {
@@ -44,7 +220,31 @@ Table& Table::addHeader(std::initializer_list<std::string> headers) {
 
 Table& Table::addRow(const Row& row) {
     m_rows.push_back(row);
+    onRowAdded(m_rows.back());
+    return *this;
+}
+
+Table& Table::addRow(Row&& row) {
+    m_rows.push_back(std::move(row));
+    onRowAdded(m_rows.back());
+    return *this;
+}
 
+Table& Table::reserveRows(size_t rows) {
+    m_rows.reserve(rows);
+    return *this;
+}
+
+Table& Table::reserveColumns(size_t columns) {
+    m_reservedColumns = columns;
+    m_columnAlignments.reserve(columns);
+    m_columnWidths.reserve(columns);
+    m_headerWidths.reserve(columns);
+    m_rowWidths.reserve(columns);
+    return *this;
+}
+
+void Table::onRowAdded(const Row& row) {
     // Ensure column alignments and widths are initialized if this is the first row
     if (m_columnAlignments.empty()) {
         m_columnAlignments.resize(row.size(), Alignment::LEFT);
@@ -53,9 +253,114 @@ Table& Table::addRow(const Row& row) {
         m_columnWidths.resize(row.size(), std::nullopt);
     }
 
+    if (m_rowWidths.size() < row.size()) {
+        m_rowWidths.resize(row.size(), 0);
+    }
+    for (size_t i = 0; i < row.size(); ++i) {
+        m_rowWidths[i] = std::max(m_rowWidths[i], row.at(i).width(columnFormat(i)));
+    }
+}
+
+void Table::remeasureColumn(size_t columnIndex) {
+    size_t width = 0;
+    for (const auto& row : m_rows) {
+        if (columnIndex < row.size()) {
+            width = std::max(width, row.at(columnIndex).width(columnFormat(columnIndex)));
+        }
+    }
+    m_rowWidths[columnIndex] = width;
+}
+
+Table& Table::setValue(size_t rowIndex, size_t columnIndex, std::string_view value) {
+    Cell& cell = m_rows.at(rowIndex).at(columnIndex);
+    const size_t oldWidth = cell.width(columnFormat(columnIndex));
+    const size_t newWidth = maxLineWidth(value);
+    cell.setValue(value);
+
+    // Only shrinking the widest cell of a column requires a rescan
+    if (newWidth >= m_rowWidths[columnIndex]) {
+        m_rowWidths[columnIndex] = newWidth;
+    } else if (oldWidth == m_rowWidths[columnIndex]) {
+        remeasureColumn(columnIndex);
+    }
+
+    return *this;
+}
+
+Table& Table::sortBy(size_t columnIndex, const SortOptions& options) {
+    if (columnIndex >= columnCount()) {
+        throw std::out_of_range("Column index out of range");
+    }
+    if (m_rows.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Too many rows to sort");
+    }
+
+    const size_t rows = m_rows.size();
+    const FormatSpec& format = columnFormat(columnIndex);
+    const unsigned threads = rows >= options.minParallelRows ? resolveThreadCount(options.threads) : 1;
+
+    // Keys are computed once, in one block per thread
+    std::vector<RowKey> keys(rows);
+    parallelFor(threads, threads, [&](size_t block) {
+        std::string buffer;
+        for (size_t r = rows * block / threads; r < rows * (block + 1) / threads; ++r) {
+            keys[r] = makeKey(m_rows[r], columnIndex, static_cast<uint32_t>(r), options.key, format, buffer);
+        }
+    });
+
+    const bool descending = options.descending;
+    auto less = [&](const RowKey& a, const RowKey& b) {
+        if (((a.flags | b.flags) & kMissingValue) != 0) {
+            return (a.flags & kMissingValue) == 0 && (b.flags & kMissingValue) != 0;
+        }
+        if (a.prefix != b.prefix) {
+            return descending ? a.prefix > b.prefix : a.prefix < b.prefix;
+        }
+        if (((a.flags ^ b.flags) & kPastInt64) != 0) {
+            return ((descending ? a.flags : b.flags) & kPastInt64) != 0;
+        }
+        if (((a.flags | b.flags) & kLongText) == 0) {
+            return false;
+        }
+
+        // Equal prefixes of long texts or texts with NUL bytes: compare the cells themselves
+        // (numbers are never long)
+        std::string bufferA;
+        std::string bufferB;
+        const std::string_view textA = m_rows[a.row].at(columnIndex).format(bufferA, format);
+        const std::string_view textB = m_rows[b.row].at(columnIndex).format(bufferB, format);
+        return descending ? textB < textA : textA < textB;
+    };
+    parallelSort(keys.begin(), keys.end(), less, threads, options.stable);
+
+    std::vector<size_t> order(rows);
+    for (size_t r = 0; r < rows; ++r) {
+        order[r] = keys[r].row;
+    }
+    keys = {};
+    permuteRows(order);
     return *this;
 }
 
+void Table::permuteRows(std::vector<size_t>& order) {
+    // Follow each cycle of the permutation, marking placed rows with their own index
+    for (size_t start = 0; start < order.size(); ++start) {
+        if (order[start] == start) {
+            continue;
+        }
+        Row first = std::move(m_rows[start]);
+        size_t position = start;
+        while (order[position] != start) {
+            const size_t source = order[position];
+            m_rows[position] = std::move(m_rows[source]);
+            order[position] = position;
+            position = source;
+        }
+        m_rows[position] = std::move(first);
+        order[position] = position;
+    }
+}
+
 Table& Table::setTheme(Theme theme) {
     m_theme = theme;
     m_border = getBorderForTheme(theme);
@@ -75,6 +380,23 @@ Table& Table::setColumnAlignment(size_t columnIndex, Alignment alignment) {
     return *this;
 }
 
+Table& Table::setColumnFormat(size_t columnIndex, std::string_view spec) {
+    const FormatSpec format = FormatSpec::parse(spec);
+    if (columnIndex >= m_columnFormats.size()) {
+        m_columnFormats.resize(columnIndex + 1);
+    }
+    m_columnFormats[columnIndex] = format;
+
+    // Numeric cells change width with their format
+    if (columnIndex < m_headerWidths.size()) {
+        m_headerWidths[columnIndex] = m_header->at(columnIndex).width(format);
+    }
+    if (columnIndex < m_rowWidths.size()) {
+        remeasureColumn(columnIndex);
+    }
+    return *this;
+}
+
 Table& Table::setColumnWidth(size_t columnIndex, std::optional<size_t> width) {
     if (columnIndex >= m_columnWidths.size()) {
         m_columnWidths.resize(columnIndex + 1, std::nullopt);
@@ -97,6 +419,39 @@ size_t Table::columnCount() const noexcept {
     return 0;
 }
 
+const Border& Table::border() const noexcept {
+    return m_border;
+}
+
+Theme Table::theme() const noexcept {
+    return m_theme;
+}
+
+const std::optional<Row>& Table::header() const noexcept {
+    return m_header;
+}
+
+std::span<const Row> Table::rows() const noexcept {
+    return m_rows;
+}
+
+Alignment Table::columnAlignment(size_t columnIndex) const noexcept {
+    return columnIndex < m_columnAlignments.size() ? m_columnAlignments[columnIndex] : Alignment::LEFT;
+}
+
+const FormatSpec& Table::columnFormat(size_t columnIndex) const noexcept {
+    static const FormatSpec kDefaultFormat;
+    return columnIndex < m_columnFormats.size() ? m_columnFormats[columnIndex] : kDefaultFormat;
+}
+
+std::optional<size_t> Table::fixedColumnWidth(size_t columnIndex) const noexcept {
+    return columnIndex < m_columnWidths.size() ? m_columnWidths[columnIndex] : std::nullopt;
+}
+
+std::vector<size_t> Table::columnWidths() const {
+    return calculateColumnWidths();
+}
+
 bool Table::empty() const noexcept {
     return m_rows.empty() && !m_header.has_value();
 }
@@ -104,64 +459,52 @@ bool Table::empty() const noexcept {
 Table& Table::clear() noexcept {
     m_rows.clear();
     m_header.reset();
+    m_headerWidths.clear();
+    m_rowWidths.clear();
     return *this;
 }
 
-std::string Table::str() const {
-    return render();
-}
-
-std::ostream& operator<<(std::ostream& os, const Table& table) {
-    return os << table.str();
+std::string Table::str(const RenderOptions& options) const {
+    std::string result;
+    BufferedWriter out(result);
+    render(out, options);
+    return result;
 }
 
-// Helper function to split text by newlines
-std::vector<std::string> Table::splitLines(const std::string& text) const {
-    std::vector<std::string> lines;
-    std::stringstream ss(text);
-    std::string line;
-
-    while (std::getline(ss, line)) {
-        lines.push_back(line);
-    }
-
-    // Handle case where text doesn't end with newline or is empty
-    if (lines.empty()) {
-        lines.push_back(text);
-    }
-
-    return lines;
+void Table::renderTo(OutputSink& sink, const RenderOptions& options) const {
+    BufferedWriter out(sink);
+    render(out, options);
+    out.flush();
 }
 
-// Helper function to get maximum line width in a multiline text
-size_t Table::getMaxLineWidth(const std::string& text) const {
-    const auto lines = splitLines(text);
-    size_t maxWidth = 0;
-    for (const auto& line : lines) {
-        maxWidth = std::max(maxWidth, line.size());
-    }
-    return maxWidth;
+std::ostream& operator<<(std::ostream& os, const Table& table) {
+    StreamSink sink(os);
+    table.renderTo(sink);
+    return os;
 }
 
-std::vector<size_t> Table::calculateColumnWidths() const {
+std::vector<size_t> Table::calculateColumnWidths(std::optional<size_t> sampleRows) const {
     const size_t columns = columnCount();
     if (columns == 0) return {};
 
     std::vector<size_t> widths(columns, 0);
 
-    // Check header widths (considering multiline content)
-    if (m_header.has_value()) {
-        for (size_t i = 0; i < m_header->size() && i < columns; ++i) {
-            const std::string cellValue = m_header->at(i).value();
-            widths[i] = std::max(widths[i], getMaxLineWidth(cellValue));
+    // Combine the widths maintained by addHeader/addRow/setValue
+    for (size_t i = 0; i < columns; ++i) {
+        if (i < m_headerWidths.size()) {
+            widths[i] = m_headerWidths[i];
+        }
+        if (i < m_rowWidths.size() && !sampleRows.has_value()) {
+            widths[i] = std::max(widths[i], m_rowWidths[i]);
         }
     }
 
-    // Check data row widths (considering multiline content)
-    for (const auto& row : m_rows) {
-        for (size_t i = 0; i < row.size() && i < columns; ++i) {
-            const std::string cellValue = row.at(i).value();
-            widths[i] = std::max(widths[i], getMaxLineWidth(cellValue));
+    // A sample only measures the leading rows
+    if (sampleRows.has_value()) {
+        for (const auto& row : std::span(m_rows).first(std::min(*sampleRows, m_rows.size()))) {
+            for (size_t i = 0; i < columns && i < row.size(); ++i) {
+                widths[i] = std::max(widths[i], row.at(i).width(columnFormat(i)));
+            }
         }
     }
 
@@ -175,149 +518,73 @@ std::vector<size_t> Table::calculateColumnWidths() const {
     return widths;
 }
 
-std::string Table::render() const {
+void Table::render(BufferedWriter& out, const RenderOptions& options) const {
     if (empty()) {
-        return "";
+        return;
     }
 
-    const auto columnWidths = calculateColumnWidths();
-    const size_t columns = columnWidths.size();
-    const bool hasBorder = m_border.enabled();
-
-    std::string result;
-
-    // Helper for padding cells according to alignment
-    auto padCell = [&](const std::string& text, size_t width, Alignment align) -> std::string {
-        if (text.size() >= width) {
-            return text.substr(0, width); // Truncate if too long
-        }
-
-        switch (align) {
-            case Alignment::RIGHT: {
-                return std::string(width - text.size(), ' ') + text;
-            }
-            case Alignment::CENTER: {
-                size_t leftPad = (width - text.size()) / 2;
-                size_t rightPad = width - text.size() - leftPad;
-                return std::string(leftPad, ' ') + text + std::string(rightPad, ' ');
-            }
-            case Alignment::LEFT:
-            default: {
-                return text + std::string(width - text.size(), ' ');
-            }
-        }
-    };
-
-    // Helper to render a multi-line row
-    auto renderMultilineRow = [&](const Row& row) -> std::string {
-        std::string rowResult;
-
-        // Split all cells in the row into lines
-        std::vector<std::vector<std::string>> cellLines(columns);
-        size_t maxLines = 0;
-
-        for (size_t i = 0; i < columns; ++i) {
-            const auto& cell = i < row.size() ? row.at(i) : Cell("");
-            cellLines[i] = splitLines(cell.value());
-            maxLines = std::max(maxLines, cellLines[i].size());
-        }
-
-        // Ensure all cells have the same number of lines (pad with empty strings)
-        for (auto& lines : cellLines) {
-            while (lines.size() < maxLines) {
-                lines.emplace_back("");
-            }
-        }
-
-        // Render each line of the row
-        for (size_t lineIdx = 0; lineIdx < maxLines; ++lineIdx) {
-            if (hasBorder) {
-                rowResult += m_border.vertical();
-            }
-
-            for (size_t i = 0; i < columns; ++i) {
-                const auto& cell = i < row.size() ? row.at(i) : Cell("");
-                Alignment align = cell.alignment().value_or(
-                    i < m_columnAlignments.size() ? m_columnAlignments[i] : Alignment::LEFT
-                                                           );
-
-                const std::string& lineText = cellLines[i][lineIdx];
-                rowResult += " " + padCell(lineText, columnWidths[i], align) + " ";
-
-                if (hasBorder && i < columns - 1) {
-                    rowResult += m_border.vertical();
-                }
-            }
+    const Border& border = options.border.has_value() ? *options.border : m_border;
 
-            if (hasBorder) {
-                rowResult += m_border.vertical();
-            }
-            rowResult += "\n";
-        }
-
-        return rowResult;
+    // Widths are maintained incrementally or sampled, so a page only pays for its own rows
+    const auto allWidths = calculateColumnWidths(options.sampleRows);
+    const auto [firstColumn, columns] = clampRange(allWidths.size(), options.columnOffset, options.columnLimit);
+    if (columns == 0) {
+        return;
+    }
+    const std::span<const size_t> columnWidths = std::span(allWidths).subspan(firstColumn, columns);
+    const auto [firstAlignment, alignments] = clampRange(m_columnAlignments.size(), firstColumn, columns);
+    const std::span<const Alignment> columnAlignments = std::span(m_columnAlignments).subspan(firstAlignment, alignments);
+    const Renderer renderer(border, columnWidths, columnAlignments, options.overflow);
+    RowViews views(*this, firstColumn, columns);
+
+    // Data rows are split into blocks that threads render independently
+    const auto [firstRow, pageRows] = clampRange(m_rows.size(), options.rowOffset, options.rowLimit);
+    const std::span<const Row> rows = std::span<const Row>(m_rows).subspan(firstRow, pageRows);
+    const size_t blockRows = std::max<size_t>(options.rowsPerBlock, 1);
+    const size_t blocks = (rows.size() + blockRows - 1) / blockRows;
+    const unsigned threads = blocks > 1 ? static_cast<unsigned>(std::min<size_t>(resolveThreadCount(options.threads), blocks)) : 1;
+    auto block = [&](size_t index) {
+        return rows.subspan(index * blockRows, std::min(blockRows, rows.size() - index * blockRows));
     };
 
-    // Render top border
-    if (hasBorder) {
-        result += m_border.topLeft();
-        for (size_t i = 0; i < columns; ++i) {
-            result += std::string(columnWidths[i] + 2, m_border.horizontal()[0]);
-            if (i < columns - 1) {
-                result += m_border.topIntersection();
-            }
+    // Rendering into a string: size it exactly so the output is allocated once
+    if (out.direct()) {
+        size_t size = renderer.bordersSize(m_header.has_value(), rows.size());
+        if (m_header.has_value()) {
+            size += renderer.rowSize(views(*m_header));
         }
-        result += m_border.topRight() + "\n";
-    }
-
-    // Render header
-    if (m_header.has_value()) {
-        result += renderMultilineRow(*m_header);
-
-        // Render header separator
-        if (hasBorder) {
-            result += m_border.leftIntersection();
-            for (size_t i = 0; i < columns; ++i) {
-                result += std::string(columnWidths[i] + 2, m_border.horizontal()[0]);
-                if (i < columns - 1) {
-                    result += m_border.crossIntersection();
-                }
-            }
-            result += m_border.rightIntersection() + "\n";
+        if (threads > 1) {
+            std::vector<size_t> blockSizes(blocks);
+            parallelFor(blocks, threads, [&](size_t index) {
+                RowViews blockViews(*this, firstColumn, columns);
+                blockSizes[index] = rowsSize(renderer, blockViews, block(index));
+            });
+            size += std::accumulate(blockSizes.begin(), blockSizes.end(), size_t{0});
+        } else {
+            size += rowsSize(renderer, views, rows);
         }
+        out.reserve(size);
     }
 
-    // Render data rows
-    for (size_t rowIdx = 0; rowIdx < m_rows.size(); ++rowIdx) {
-        const auto& row = m_rows[rowIdx];
-        result += renderMultilineRow(row);
+    renderer.writeTop(out);
 
-        // Add row separator if not the last row
-        if (hasBorder && rowIdx < m_rows.size() - 1) {
-            result += m_border.leftIntersection();
-            for (size_t i = 0; i < columns; ++i) {
-                result += std::string(columnWidths[i] + 2, m_border.horizontal()[0]);
-                if (i < columns - 1) {
-                    result += m_border.crossIntersection();
-                }
-            }
-            result += m_border.rightIntersection() + "\n";
-        }
+    if (m_header.has_value()) {
+        renderer.writeRow(out, views(*m_header));
+        renderer.writeHeaderSeparator(out);
     }
 
-    // Render bottom border
-    if (hasBorder) {
-        result += m_border.bottomLeft();
-        for (size_t i = 0; i < columns; ++i) {
-            result += std::string(columnWidths[i] + 2, m_border.horizontal()[0]);
-            if (i < columns - 1) {
-                result += m_border.bottomIntersection();
-            }
-        }
-        result += m_border.bottomRight() + "\n";
+    if (threads > 1) {
+        parallelWrite(out, blocks, threads, [&](size_t index, BufferedWriter& blockOut) {
+            // Renderers keep scratch state, so every block gets its own
+            const Renderer blockRenderer(border, columnWidths, columnAlignments, options.overflow);
+            RowViews blockViews(*this, firstColumn, columns);
+            writeRows(blockOut, blockRenderer, blockViews, block(index), index == blocks - 1);
+        });
+    } else {
+        writeRows(out, renderer, views, rows, true);
     }
 
-    return result;
+    renderer.writeBottom(out);
 }
 
 } // namespace tabulix
@@ -0,0 +1,201 @@
+/**
+ * @file table_writer.cpp
+ * @brief Implementation of the TableWriter class
+ */
+
+#include "tabulix/core/table_writer.hpp"
+#include "tabulix/styling/theme.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace tabulix {
+
+TableWriter::TableWriter(OutputSink& sink, const std::vector<std::string>& header,
+                         std::vector<size_t> columnWidths, const RenderOptions& options)
+    : m_out(sink)
+    , m_border(options.border.value_or(getBorderForTheme(Theme::GRID)))
+    , m_overflow(options.overflow)
+    , m_header(header)
+    , m_widths(std::move(columnWidths)) {
+}
+
+TableWriter::TableWriter(OutputSink& sink, const std::vector<std::string>& header,
+                         std::initializer_list<size_t> columnWidths, const RenderOptions& options)
+    : TableWriter(sink, header, std::vector<size_t>(columnWidths), options) {
+}
+
+TableWriter::TableWriter(OutputSink& sink, const std::vector<std::string>& header, const RenderOptions& options)
+    : m_out(sink)
+    , m_border(options.border.value_or(getBorderForTheme(Theme::GRID)))
+    , m_overflow(options.overflow)
+    , m_header(header)
+    , m_sampleRows(options.sampleRows.value_or(kDefaultSampleRows)) {
+    m_sample.emplace();
+    if (!m_header.empty()) {
+        m_sample->addHeader(m_header);
+    }
+}
+
+TableWriter::~TableWriter() {
+    if (!m_finished) {
+        try {
+            finish();
+        } catch (...) {
+            // Destructors must not throw; finish() reports sink errors
+        }
+    }
+}
+
+TableWriter& TableWriter::setColumnAlignment(size_t columnIndex, Alignment alignment) {
+    // Once rendering started the renderer refers to the alignments, so they are not resized
+    if (columnIndex >= m_alignments.size()) {
+        if (m_started) {
+            return *this;
+        }
+        m_alignments.resize(columnIndex + 1, Alignment::LEFT);
+    }
+    m_alignments[columnIndex] = alignment;
+    return *this;
+}
+
+TableWriter& TableWriter::writeRow(std::span<const std::string_view> cells) {
+    checkOpen();
+    if (m_sample.has_value() && m_sample->rows().size() < m_sampleRows) {
+        Row row(m_sample->get_allocator());
+        row.reserve(cells.size());
+        for (const auto cell : cells) {
+            row.addCell(cell);
+        }
+        return writeRow(row);
+    }
+
+    ++m_rows;
+    if (!m_started) {
+        start();
+    }
+    for (size_t i = 0; i < m_cells.size(); ++i) {
+        m_cells[i] = i < cells.size() ? CellView{cells[i]} : CellView{};
+    }
+    emitRow(m_cells);
+    m_out.flush();
+    return *this;
+}
+
+TableWriter& TableWriter::writeRow(std::initializer_list<std::string_view> cells) {
+    return writeRow(std::span<const std::string_view>(cells.begin(), cells.size()));
+}
+
+TableWriter& TableWriter::writeRow(const Row& row) {
+    checkOpen();
+    ++m_rows;
+
+    // Hold rows back until the sample is complete
+    if (m_sample.has_value() && m_sample->rows().size() < m_sampleRows) {
+        m_sample->addRow(row);
+        if (m_sample->rows().size() == m_sampleRows) {
+            start();
+            m_out.flush();
+        }
+        return *this;
+    }
+
+    if (!m_started) {
+        start();
+    }
+    emitRow(row);
+    m_out.flush();
+    return *this;
+}
+
+size_t TableWriter::rowCount() const noexcept {
+    return m_rows;
+}
+
+std::span<const size_t> TableWriter::columnWidths() const noexcept {
+    if (!m_started && m_sample.has_value()) {
+        return {};
+    }
+    return m_widths;
+}
+
+void TableWriter::finish() {
+    if (m_finished) {
+        return;
+    }
+    m_finished = true;
+
+    // Like an empty Table, a writer without header and rows renders nothing
+    if (!m_started) {
+        if (m_header.empty() && m_rows == 0) {
+            return;
+        }
+        start();
+    }
+    if (m_renderer.has_value()) {
+        m_renderer->writeBottom(m_out);
+    }
+    m_out.flush();
+}
+
+void TableWriter::start() {
+    m_started = true;
+    if (m_sample.has_value()) {
+        m_widths = m_sample->columnWidths();
+    }
+
+    const size_t columns = m_widths.size();
+    m_alignments.resize(columns, Alignment::LEFT);
+    m_cells.resize(columns);
+    m_numbers.resize(columns);
+    if (columns == 0) {
+        m_sample.reset();
+        return;
+    }
+    m_renderer.emplace(m_border, m_widths, m_alignments, m_overflow);
+
+    m_renderer->writeTop(m_out);
+    if (!m_header.empty()) {
+        for (size_t i = 0; i < columns; ++i) {
+            m_cells[i] = i < m_header.size() ? CellView{m_header[i]} : CellView{};
+        }
+        m_renderer->writeRow(m_out, m_cells);
+        m_renderer->writeHeaderSeparator(m_out);
+    }
+
+    // Write the rows the widths were sampled from, then let them go
+    if (m_sample.has_value()) {
+        for (const auto& row : m_sample->rows()) {
+            emitRow(row);
+        }
+        m_sample.reset();
+    }
+}
+
+void TableWriter::emitRow(std::span<const CellView> cells) {
+    if (!m_renderer.has_value()) {
+        return;
+    }
+    if (m_emitted++ > 0) {
+        m_renderer->writeRowSeparator(m_out);
+    }
+    m_renderer->writeRow(m_out, cells);
+}
+
+void TableWriter::emitRow(const Row& row) {
+    for (size_t i = 0; i < m_cells.size(); ++i) {
+        if (i < row.size()) {
+            m_cells[i] = {row.at(i).format(m_numbers[i]), row.at(i).alignment()};
+        } else {
+            m_cells[i] = {};
+        }
+    }
+    emitRow(m_cells);
+}
+
+void TableWriter::checkOpen() const {
+    if (m_finished) {
+        throw std::logic_error("TableWriter: row written after finish()");
+    }
+}
+
+} // namespace tabulix
@@ -0,0 +1,147 @@
+/**
+ * @file text.cpp
+ * @brief Implementation of text measurement helpers
+ */
+
+#include "tabulix/core/text.hpp"
+#include "tabulix/core/width.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TABULIX_HAS_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TABULIX_HAS_SSE2 1
+#endif
+
+namespace tabulix {
+
+namespace {
+
+// Scalar tail handling for the vectorized scanners
+size_t findNewlineScalar(const char* data, size_t pos, size_t size) noexcept {
+    const void* found = std::memchr(data + pos, '\n', size - pos);
+    return found != nullptr ? static_cast<size_t>(static_cast<const char*>(found) - data) : std::string_view::npos;
+}
+
+} // namespace
+
+size_t findNewline(std::string_view text) noexcept {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_AVX2)
+    const __m256i newlines32 = _mm256_set1_epi8('\n');
+    for (; i + 32 <= size; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newlines32)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i newlines16 = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newlines16)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    return i < size ? findNewlineScalar(data, i, size) : std::string_view::npos;
+}
+
+size_t countNewlines(std::string_view text) noexcept {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_AVX2)
+    const __m256i newlines32 = _mm256_set1_epi8('\n');
+    for (; i + 32 <= size; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, newlines32)));
+        count += static_cast<size_t>(std::popcount(mask));
+    }
+#endif
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i newlines16 = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newlines16)));
+        count += static_cast<size_t>(std::popcount(mask));
+    }
+#endif
+
+    for (; i < size; ++i) {
+        count += data[i] == '\n' ? 1 : 0;
+    }
+    return count;
+}
+
+std::vector<std::string_view> splitLines(std::string_view text) {
+    std::vector<std::string_view> lines;
+
+    size_t pos = 0;
+    while (pos < text.size()) {
+        const size_t newline = findNewline(text.substr(pos));
+        if (newline == std::string_view::npos) {
+            lines.push_back(text.substr(pos));
+            break;
+        }
+        lines.push_back(text.substr(pos, newline));
+        pos += newline + 1;
+    }
+
+    // Empty text still occupies one (empty) line
+    if (lines.empty()) {
+        lines.emplace_back();
+    }
+
+    return lines;
+}
+
+size_t countLines(std::string_view text) noexcept {
+    const size_t newlines = countNewlines(text);
+
+    // A trailing newline does not start another line
+    const bool unterminated = !text.empty() && text.back() != '\n';
+    return std::max<size_t>(1, newlines + (unterminated ? 1 : 0));
+}
+
+std::string_view nextLine(std::string_view& text) noexcept {
+    const size_t newline = findNewline(text);
+    if (newline == std::string_view::npos) {
+        return std::exchange(text, std::string_view{});
+    }
+    const auto line = text.substr(0, newline);
+    text.remove_prefix(newline + 1);
+    return line;
+}
+
+size_t maxLineWidth(std::string_view text) {
+    // Most cells hold a single line: measure it without splitting
+    const size_t newline = findNewline(text);
+    if (newline == std::string_view::npos) {
+        return displayWidth(text);
+    }
+
+    size_t maxWidth = displayWidth(text.substr(0, newline));
+    text.remove_prefix(newline + 1);
+    while (!text.empty()) {
+        maxWidth = std::max(maxWidth, displayWidth(nextLine(text)));
+    }
+    return maxWidth;
+}
+
+} // namespace tabulix
@@ -4,23 +4,604 @@
  */
 
 #include "tabulix/export/exporter.hpp"
-#include <sstream>
-#include <fstream>
+#include "tabulix/import/snapshot.hpp"
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TABULIX_HAS_SSE2 1
+#endif
 
 namespace tabulix {
 
-bool Exporter::toFile(const Table& table, const std::string& filename) const {
-    try {
-        std::ofstream file(filename);
-        if (!file.is_open()) {
-            return false;
+namespace {
+
+/**
+ * @brief Check whether a CSV field must be quoted
+ *
+ * Scans 16 bytes at a time for the delimiter, a double quote, CR or LF, so
+ * the common clean field is confirmed without a per-byte branch.
+ */
+bool needsCsvQuoting(std::string_view field, char delimiter) noexcept {
+    const char* data = field.data();
+    const size_t size = field.size();
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i delimiters = _mm_set1_epi8(delimiter);
+    const __m128i quotes = _mm_set1_epi8('"');
+    const __m128i carriageReturns = _mm_set1_epi8('\r');
+    const __m128i lineFeeds = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiters), _mm_cmpeq_epi8(chunk, quotes)),
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, carriageReturns), _mm_cmpeq_epi8(chunk, lineFeeds)));
+        if (_mm_movemask_epi8(special) != 0) {
+            return true;
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        const char c = data[i];
+        if (c == delimiter || c == '"' || c == '\r' || c == '\n') {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Escape class of every byte in a JSON string: 0 copies it, 'u' needs \u00XX,
+// anything else is the letter of its two-character escape
+constexpr std::array<char, 256> kJsonEscapes = [] {
+    std::array<char, 256> escapes{};
+    for (size_t c = 0; c < 0x20; ++c) {
+        escapes[c] = 'u';
+    }
+    escapes['\b'] = 'b';
+    escapes['\f'] = 'f';
+    escapes['\n'] = 'n';
+    escapes['\r'] = 'r';
+    escapes['\t'] = 't';
+    escapes['"'] = '"';
+    escapes['\\'] = '\\';
+    return escapes;
+}();
+
+/**
+ * @brief Get the number of leading bytes that need no escaping in a JSON string
+ */
+size_t jsonCleanPrefix(std::string_view text) noexcept {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i controlLimit = _mm_set1_epi8(0x1F);
+    const __m128i quotes = _mm_set1_epi8('"');
+    const __m128i backslashes = _mm_set1_epi8('\\');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        // Unsigned c <= 0x1F  <=>  min(c, 0x1F) == c
+        const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chunk, controlLimit), chunk);
+        const __m128i special = _mm_or_si128(
+            control, _mm_or_si128(_mm_cmpeq_epi8(chunk, quotes), _mm_cmpeq_epi8(chunk, backslashes)));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        if (kJsonEscapes[static_cast<unsigned char>(data[i])] != 0) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Write a JSON string literal
+ */
+void writeJsonString(BufferedWriter& out, std::string_view text) {
+    static constexpr char kHexDigits[] = "0123456789abcdef";
+
+    out.write("\"");
+    while (!text.empty()) {
+        const size_t clean = jsonCleanPrefix(text);
+        out.write(text.substr(0, clean));
+        if (clean == text.size()) {
+            break;
+        }
+
+        const auto c = static_cast<unsigned char>(text[clean]);
+        const char escape = kJsonEscapes[c];
+        if (escape == 'u') {
+            const char sequence[] = {'\\', 'u', '0', '0', kHexDigits[c >> 4], kHexDigits[c & 0xF]};
+            out.write(std::string_view(sequence, sizeof(sequence)));
+        } else {
+            const char sequence[] = {'\\', escape};
+            out.write(std::string_view(sequence, sizeof(sequence)));
+        }
+        text.remove_prefix(clean + 1);
+    }
+    out.write("\"");
+}
+
+// Replacement of every byte in HTML text; empty entries are copied as they are
+constexpr std::array<std::string_view, 256> kHtmlEntities = [] {
+    std::array<std::string_view, 256> entities{};
+    entities['&'] = "&amp;";
+    entities['<'] = "&lt;";
+    entities['>'] = "&gt;";
+    entities['"'] = "&quot;";
+    entities['\''] = "&#39;";
+    entities['\n'] = "<br>";
+    return entities;
+}();
+
+/**
+ * @brief Get the number of leading bytes that need no replacement in HTML text
+ */
+size_t htmlCleanPrefix(std::string_view text) noexcept {
+    const char* data = text.data();
+    const size_t size = text.size();
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i ampersands = _mm_set1_epi8('&');
+    const __m128i lessThans = _mm_set1_epi8('<');
+    const __m128i greaterThans = _mm_set1_epi8('>');
+    const __m128i quotes = _mm_set1_epi8('"');
+    const __m128i apostrophes = _mm_set1_epi8('\'');
+    const __m128i newlines = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i markup = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, ampersands), _mm_cmpeq_epi8(chunk, lessThans)),
+            _mm_cmpeq_epi8(chunk, greaterThans));
+        const __m128i other = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, quotes), _mm_cmpeq_epi8(chunk, apostrophes)),
+            _mm_cmpeq_epi8(chunk, newlines));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(markup, other)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        if (!kHtmlEntities[static_cast<unsigned char>(data[i])].empty()) {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Write text with HTML special characters replaced by entities
+ */
+void writeHtmlText(BufferedWriter& out, std::string_view text) {
+    while (!text.empty()) {
+        const size_t clean = htmlCleanPrefix(text);
+        out.write(text.substr(0, clean));
+        if (clean == text.size()) {
+            break;
+        }
+        out.write(kHtmlEntities[static_cast<unsigned char>(text[clean])]);
+        text.remove_prefix(clean + 1);
+    }
+}
+
+
+// Row index that refers to the header in the cell adapters below
+constexpr size_t kHeaderRow = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief Cells of a Table as the exporters read them
+ */
+class TableCells {
+public:
+    explicit TableCells(const Table& table) noexcept : m_table(table), m_rows(table.rows()) {
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_table.empty(); }
+    [[nodiscard]] bool hasHeader() const noexcept { return m_table.header().has_value(); }
+    [[nodiscard]] size_t columnCount() const noexcept { return m_table.columnCount(); }
+    [[nodiscard]] size_t rowCount() const noexcept { return m_rows.size(); }
+    [[nodiscard]] Alignment columnAlignment(size_t column) const noexcept { return m_table.columnAlignment(column); }
+
+    // Text in the column format, or std::nullopt past the end of the row
+    [[nodiscard]] std::optional<std::string_view> text(size_t row, size_t column, std::string& buffer) const {
+        const Cell* cell = find(row, column);
+        return cell != nullptr ? std::optional(cell->format(buffer, m_table.columnFormat(column))) : std::nullopt;
+    }
+
+    // Text with numbers in their default format, or std::nullopt past the end of the row
+    [[nodiscard]] std::optional<std::string_view> plainText(size_t row, size_t column, std::string& buffer) const {
+        const Cell* cell = find(row, column);
+        return cell != nullptr ? std::optional(cell->format(buffer)) : std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<Cell::Number> number(size_t row, size_t column) const {
+        const Cell* cell = find(row, column);
+        return cell != nullptr ? cell->number() : std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<Alignment> alignment(size_t row, size_t column) const {
+        const Cell* cell = find(row, column);
+        return cell != nullptr ? cell->alignment() : std::nullopt;
+    }
+
+private:
+    const Table& m_table;
+    std::span<const Row> m_rows;
+
+    [[nodiscard]] const Cell* find(size_t row, size_t column) const noexcept {
+        const Row& cells = row == kHeaderRow ? *m_table.header() : m_rows[row];
+        return column < cells.size() ? &cells[column] : nullptr;
+    }
+};
+
+/**
+ * @brief Cells of a ColumnarTable as the exporters read them
+ *
+ * Cells are text only. Rows hold a cell in every stored column; an empty
+ * one exports the same as a missing cell of a Table.
+ */
+class ColumnarCells {
+public:
+    explicit ColumnarCells(const ColumnarTable& table) noexcept
+        : m_table(table)
+        , m_storedColumns(table.storedColumnCount()) {
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return m_table.empty(); }
+    [[nodiscard]] bool hasHeader() const noexcept { return m_table.header().has_value(); }
+    [[nodiscard]] size_t columnCount() const noexcept { return m_table.columnCount(); }
+    [[nodiscard]] size_t rowCount() const noexcept { return m_table.rowCount() - (hasHeader() ? 1 : 0); }
+    [[nodiscard]] Alignment columnAlignment(size_t column) const noexcept { return m_table.columnAlignment(column); }
+
+    [[nodiscard]] std::optional<std::string_view> text(size_t row, size_t column, std::string&) const {
+        if (row == kHeaderRow) {
+            const auto& header = *m_table.header();
+            return column < header.size() ? std::optional<std::string_view>(header[column]) : std::nullopt;
         }
-        file << toString(table);
-        return !file.bad();
+        return column < m_storedColumns ? std::optional(m_table.cell(row, column)) : std::nullopt;
+    }
+
+    [[nodiscard]] std::optional<std::string_view> plainText(size_t row, size_t column, std::string& buffer) const {
+        return text(row, column, buffer);
+    }
+
+    [[nodiscard]] std::optional<Cell::Number> number(size_t, size_t) const noexcept { return std::nullopt; }
+
+    [[nodiscard]] std::optional<Alignment> alignment(size_t row, size_t column) const {
+        return row == kHeaderRow ? std::nullopt : m_table.cellAlignment(row, column);
+    }
+
+private:
+    const ColumnarTable& m_table;
+    size_t m_storedColumns;
+};
+
+/**
+ * @brief Write a table as an HTML table element
+ */
+template <typename Cells>
+void writeHtml(const Cells& cells, BufferedWriter& out) {
+    if (cells.empty()) {
+        out.write("<table></table>");
+        return;
+    }
+
+    const size_t columns = cells.columnCount();
+    std::string number;
+
+    auto writeRow = [&](size_t row, std::string_view tag) {
+        out.write("<tr>");
+        for (size_t i = 0; i < columns; ++i) {
+            const auto text = cells.text(row, i, number);
+            const Alignment align = cells.alignment(row, i).value_or(cells.columnAlignment(i));
+            out.write("<");
+            out.write(tag);
+            switch (align) {
+                case Alignment::CENTER:
+                    out.write(" style=\"text-align: center\"");
+                    break;
+                case Alignment::RIGHT:
+                    out.write(" style=\"text-align: right\"");
+                    break;
+                case Alignment::LEFT:
+                default:
+                    break;
+            }
+            out.write(">");
+            if (text.has_value()) {
+                writeHtmlText(out, *text);
+            }
+            out.write("</");
+            out.write(tag);
+            out.write(">");
+        }
+        out.write("</tr>\n");
+    };
+
+    out.write("<table>\n");
+
+    if (cells.hasHeader()) {
+        out.write("<thead>\n");
+        writeRow(kHeaderRow, "th");
+        out.write("</thead>\n");
+
+        // Let the receiver lay out the columns while the body is produced
+        out.flush();
+    }
+
+    out.write("<tbody>\n");
+    for (size_t row = 0; row < cells.rowCount(); ++row) {
+        writeRow(row, "td");
+    }
+    out.write("</tbody>\n");
+
+    out.write("</table>");
+}
+
+/**
+ * @brief Write one CSV record with exactly one field per column
+ */
+template <typename Cells>
+void writeCsvRecord(const Cells& cells, size_t row, char delimiter, std::string& number, BufferedWriter& out) {
+    const size_t columns = cells.columnCount();
+    for (size_t i = 0; i < columns; ++i) {
+        if (i > 0) {
+            out.write(std::string_view(&delimiter, 1));
+        }
+        const auto text = cells.text(row, i, number);
+        if (!text.has_value()) {
+            continue;
+        }
+
+        std::string_view value = *text;
+        if (!needsCsvQuoting(value, delimiter)) {
+            out.write(value);
+            continue;
+        }
+
+        // Enclose in quotes and double every embedded quote
+        out.write("\"");
+        for (size_t quote = value.find('"'); quote != std::string_view::npos; quote = value.find('"')) {
+            out.write(value.substr(0, quote + 1));
+            out.write("\"");
+            value.remove_prefix(quote + 1);
+        }
+        out.write(value);
+        out.write("\"");
+    }
+    out.write("\r\n");
+}
+
+/**
+ * @brief Write all CSV records of a table
+ */
+template <typename Cells>
+void writeCsv(const Cells& cells, char delimiter, BufferedWriter& out) {
+    std::string number;
+    if (cells.hasHeader()) {
+        writeCsvRecord(cells, kHeaderRow, delimiter, number, out);
+    }
+    for (size_t row = 0; row < cells.rowCount(); ++row) {
+        writeCsvRecord(cells, row, delimiter, number, out);
+    }
+}
+
+/**
+ * @brief Write a table as a JSON document
+ */
+template <typename Cells>
+void writeJson(const Cells& cells, JsonLayout layout, BufferedWriter& out) {
+    const size_t columns = cells.columnCount();
+    const size_t rows = cells.rowCount();
+
+    // Escape every key once: "key":
+    std::string number;
+    std::vector<std::string> keys(columns);
+    for (size_t i = 0; i < columns; ++i) {
+        const std::string index = std::to_string(i);
+        const auto name = cells.hasHeader() ? cells.plainText(kHeaderRow, i, number) : std::nullopt;
+        BufferedWriter keyOut(keys[i]);
+        writeJsonString(keyOut, name.value_or(std::string_view(index)));
+        keyOut.write(":");
+    }
+
+    auto writeValue = [&](size_t row, size_t column) {
+        const auto text = cells.plainText(row, column, number);
+        if (!text.has_value()) {
+            out.write("\"\"");
+            return;
+        }
+
+        // Numbers stay numbers, in their shortest round-trip form; JSON has no NaN or infinity
+        if (const auto value = cells.number(row, column)) {
+            const auto* real = std::get_if<double>(&*value);
+            out.write(real != nullptr && !std::isfinite(*real) ? std::string_view("null") : *text);
+            return;
+        }
+        writeJsonString(out, *text);
+    };
+
+    auto writeObject = [&](size_t row) {
+        out.write("{");
+        for (size_t i = 0; i < columns; ++i) {
+            if (i > 0) {
+                out.write(",");
+            }
+            out.write(keys[i]);
+            writeValue(row, i);
+        }
+        out.write("}");
+    };
+
+    switch (layout) {
+        case JsonLayout::COLUMNAR: {
+            out.write("{");
+            for (size_t i = 0; i < columns; ++i) {
+                out.write(i > 0 ? ",\n" : "\n");
+                out.write(keys[i]);
+                out.write("[");
+                for (size_t row = 0; row < rows; ++row) {
+                    if (row > 0) {
+                        out.write(",");
+                    }
+                    writeValue(row, i);
+                }
+                out.write("]");
+            }
+            out.write(columns > 0 ? "\n}\n" : "}\n");
+            break;
+        }
+        case JsonLayout::NDJSON: {
+            for (size_t row = 0; row < rows; ++row) {
+                writeObject(row);
+                out.write("\n");
+            }
+            break;
+        }
+        case JsonLayout::ARRAY_OF_OBJECTS:
+        default: {
+            out.write("[");
+            for (size_t row = 0; row < rows; ++row) {
+                out.write(row > 0 ? ",\n" : "\n");
+                writeObject(row);
+            }
+            out.write(rows == 0 ? "]\n" : "\n]\n");
+            break;
+        }
+    }
+}
+
+// Closes a file descriptor, returning 0 or -1 with errno set
+int closeFile(int fd) noexcept {
+#if defined(_WIN32)
+    return ::_close(fd);
+#else
+    return ::close(fd);
+#endif
+}
+
+/**
+ * @class ExportFileSink
+ * @brief File sink remembering the error a failed write threw
+ *
+ * Tells failures of the file apart from other std::system_error exceptions
+ * raised while exporting, such as failing to start a render thread.
+ */
+class ExportFileSink : public FileDescriptorSink {
+public:
+    using FileDescriptorSink::FileDescriptorSink;
+
+    void write(std::string_view data) override {
+        try {
+            FileDescriptorSink::write(data);
+        } catch (const std::system_error& e) {
+            m_error = e.code();
+            throw;
+        }
+    }
+
+    [[nodiscard]] const std::error_code& error() const noexcept {
+        return m_error;
+    }
+
+private:
+    std::error_code m_error;
+};
+
+/**
+ * @brief Write an export into a file
+ * @param filename Path to the output file
+ * @param write Callable writing the export into the sink
+ * @return Number of bytes written, and the system error if opening, writing or closing failed
+ * @throws Any exception from @p write other than a failed write to the file and std::bad_alloc
+ */
+ExportResult writeFile(const std::string& filename, const std::function<void(OutputSink&)>& write) {
+    ExportResult result;
+
+#if defined(_WIN32)
+    const int fd = ::_open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    const int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+    if (fd < 0) {
+        result.error = std::error_code(errno, std::generic_category());
+        return result;
+    }
+
+    ExportFileSink sink(fd);
+    try {
+        write(sink);
+    } catch (const std::bad_alloc&) {
+        result.error = std::make_error_code(std::errc::not_enough_memory);
     } catch (...) {
-        return false;
+        // Not an I/O failure, such as a thread that could not start or a bug in
+        // an exporter: report it as it is
+        if (!sink.error()) {
+            closeFile(fd);
+            throw;
+        }
+        result.error = sink.error();
     }
+    result.bytesWritten = sink.bytesWritten();
+
+    const int closed = closeFile(fd);
+    if (closed != 0 && !result.error) {
+        result.error = std::error_code(errno, std::generic_category());
+    }
+    return result;
+}
+
+} // namespace
+
+ExportResult Exporter::toFile(const Table& table, const std::string& filename) const {
+    return writeFile(filename, [&](OutputSink& sink) { toSink(table, sink); });
+}
+
+ExportResult Exporter::toFile(const ColumnarTable& table, const std::string& filename) const {
+    return writeFile(filename, [&](OutputSink& sink) { toSink(table, sink); });
+}
+
+void Exporter::toSink(const Table& table, OutputSink& sink) const {
+    sink.write(toString(table));
+}
+
+std::string Exporter::toString(const ColumnarTable& table) const {
+    return toString(table.toTable());
+}
+
+void Exporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    sink.write(toString(table));
 }
 
 std::unique_ptr<Exporter> Exporter::create(ExportFormat format) {
@@ -35,6 +616,8 @@ std::unique_ptr<Exporter> Exporter::create(ExportFormat format) {
             return std::make_unique<CsvExporter>();
         case ExportFormat::JSON:
             return std::make_unique<JsonExporter>();
+        case ExportFormat::BINARY:
+            return std::make_unique<BinaryExporter>();
         default:
             throw std::invalid_argument("Unknown export format");
     }
@@ -45,38 +628,60 @@ std::string TextExporter::toString(const Table& table) const {
     return table.str();
 }
 
+void TextExporter::toSink(const Table& table, OutputSink& sink) const {
+    table.renderTo(sink);
+}
+
+std::string TextExporter::toString(const ColumnarTable& table) const {
+    return table.str();
+}
+
+void TextExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    table.renderTo(sink);
+}
+
 // MarkdownExporter implementation
 std::string MarkdownExporter::toString(const Table& table) const {
-    if (table.empty()) {
-        return "";
-    }
+    return table.str({.border = getBorderForTheme(Theme::MARKDOWN)});
+}
 
-    const size_t columns = table.columnCount();
-    std::stringstream ss;
+void MarkdownExporter::toSink(const Table& table, OutputSink& sink) const {
+    table.renderTo(sink, {.border = getBorderForTheme(Theme::MARKDOWN)});
+}
 
-    // Create a temporary table with Markdown theme
-    Table mdTable = table;
-    mdTable.setTheme(Theme::MARKDOWN);
+std::string MarkdownExporter::toString(const ColumnarTable& table) const {
+    return table.str({.border = getBorderForTheme(Theme::MARKDOWN)});
+}
 
-    return mdTable.str();
+void MarkdownExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    table.renderTo(sink, {.border = getBorderForTheme(Theme::MARKDOWN)});
 }
 
 // HtmlExporter implementation
 std::string HtmlExporter::toString(const Table& table) const {
-    if (table.empty()) {
-        return "<table></table>";
-    }
-
-    std::stringstream ss;
-    ss << "<table>\n";
+    std::string result;
+    BufferedWriter out(result);
+    writeHtml(TableCells(table), out);
+    return result;
+}
 
-    const size_t columns = table.columnCount();
+void HtmlExporter::toSink(const Table& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeHtml(TableCells(table), out);
+    out.flush();
+}
 
-    // TODO: Implement HTML table generation
-    // This is a placeholder implementation
+std::string HtmlExporter::toString(const ColumnarTable& table) const {
+    std::string result;
+    BufferedWriter out(result);
+    writeHtml(ColumnarCells(table), out);
+    return result;
+}
 
-    ss << "</table>";
-    return ss.str();
+void HtmlExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeHtml(ColumnarCells(table), out);
+    out.flush();
 }
 
 // CsvExporter implementation
@@ -84,26 +689,81 @@ CsvExporter::CsvExporter(char delimiter) : m_delimiter(delimiter) {
 }
 
 std::string CsvExporter::toString(const Table& table) const {
-    if (table.empty()) {
-        return "";
-    }
+    std::string result;
+    BufferedWriter out(result);
+    writeCsv(TableCells(table), m_delimiter, out);
+    return result;
+}
 
-    // TODO: Implement CSV export
-    // This is a placeholder implementation
+void CsvExporter::toSink(const Table& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeCsv(TableCells(table), m_delimiter, out);
+    out.flush();
+}
+
+std::string CsvExporter::toString(const ColumnarTable& table) const {
+    std::string result;
+    BufferedWriter out(result);
+    writeCsv(ColumnarCells(table), m_delimiter, out);
+    return result;
+}
 
-    return "";
+void CsvExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeCsv(ColumnarCells(table), m_delimiter, out);
+    out.flush();
 }
 
 // JsonExporter implementation
+JsonExporter::JsonExporter(JsonLayout layout) : m_layout(layout) {
+}
+
 std::string JsonExporter::toString(const Table& table) const {
-    if (table.empty()) {
-        return "[]";
-    }
+    std::string result;
+    BufferedWriter out(result);
+    writeJson(TableCells(table), m_layout, out);
+    return result;
+}
+
+void JsonExporter::toSink(const Table& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeJson(TableCells(table), m_layout, out);
+    out.flush();
+}
+
+std::string JsonExporter::toString(const ColumnarTable& table) const {
+    std::string result;
+    BufferedWriter out(result);
+    writeJson(ColumnarCells(table), m_layout, out);
+    return result;
+}
+
+void JsonExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeJson(ColumnarCells(table), m_layout, out);
+    out.flush();
+}
+
+// BinaryExporter implementation
+std::string BinaryExporter::toString(const Table& table) const {
+    std::string result;
+    BufferedWriter out(result);
+    writeSnapshot(table, out);
+    return result;
+}
 
-    // TODO: Implement JSON export
-    // This is a placeholder implementation
+void BinaryExporter::toSink(const Table& table, OutputSink& sink) const {
+    BufferedWriter out(sink);
+    writeSnapshot(table, out);
+    out.flush();
+}
+
+std::string BinaryExporter::toString(const ColumnarTable& table) const {
+    return toString(table.toTable());
+}
 
-    return "[]";
+void BinaryExporter::toSink(const ColumnarTable& table, OutputSink& sink) const {
+    toSink(table.toTable(), sink);
 }
 
 } // namespace tabulix
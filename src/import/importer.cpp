@@ -0,0 +1,363 @@
+/**
+ * @file importer.cpp
+ * @brief Implementation of the table importers
+ */
+
+#include "tabulix/import/importer.hpp"
+#include "tabulix/core/parallel.hpp"
+#include "tabulix/core/text.hpp"
+#include "tabulix/import/mapped_file.hpp"
+#include <algorithm>
+#include <bit>
+#include <memory_resource>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TABULIX_HAS_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TABULIX_HAS_SSE2 1
+#endif
+
+namespace tabulix {
+
+namespace {
+
+/**
+ * @brief Find the end of an unquoted field
+ * @param data Input text
+ * @param pos Offset to start scanning at
+ * @param delimiter Field delimiter
+ * @return Offset of the first delimiter or newline at or after @p pos, or the size of @p data
+ */
+size_t findFieldEnd(std::string_view data, size_t pos, char delimiter) noexcept {
+    const char* bytes = data.data();
+    const size_t size = data.size();
+    size_t i = pos;
+
+#if defined(TABULIX_HAS_AVX2)
+    const __m256i delimiters32 = _mm256_set1_epi8(delimiter);
+    const __m256i newlines32 = _mm256_set1_epi8('\n');
+    for (; i + 32 <= size; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        const __m256i special = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, delimiters32), _mm256_cmpeq_epi8(chunk, newlines32));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(special));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i delimiters16 = _mm_set1_epi8(delimiter);
+    const __m128i newlines16 = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiters16), _mm_cmpeq_epi8(chunk, newlines16));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(special));
+        if (mask != 0) {
+            return i + static_cast<size_t>(std::countr_zero(mask));
+        }
+    }
+#endif
+
+    for (; i < size; ++i) {
+        if (bytes[i] == delimiter || bytes[i] == '\n') {
+            return i;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Count the double quotes in a text
+ * @param text Text to scan
+ * @return Number of '"' characters
+ */
+size_t countQuotes(std::string_view text) noexcept {
+    const char* bytes = text.data();
+    const size_t size = text.size();
+    size_t count = 0;
+    size_t i = 0;
+
+#if defined(TABULIX_HAS_AVX2)
+    const __m256i quotes32 = _mm256_set1_epi8('"');
+    for (; i + 32 <= size; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        count += static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, quotes32)))));
+    }
+#endif
+#if defined(TABULIX_HAS_SSE2)
+    const __m128i quotes16 = _mm_set1_epi8('"');
+    for (; i + 16 <= size; i += 16) {
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        count += static_cast<size_t>(std::popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quotes16)))));
+    }
+#endif
+
+    return count + static_cast<size_t>(std::count(bytes + i, bytes + size, '"'));
+}
+
+/**
+ * @brief Find the first record boundary at or after an offset
+ * @param data Input text
+ * @param pos Offset to start scanning at
+ * @param inQuotes Whether @p pos lies inside a quoted field
+ * @return Offset just past the first newline outside quotes, or the size of @p data
+ */
+size_t findRecordStart(std::string_view data, size_t pos, bool inQuotes) noexcept {
+    // Quotes and newlines are the only bytes that matter: reuse the field scanner for them
+    for (;;) {
+        const size_t next = findFieldEnd(data, pos, '"');
+        if (next == data.size()) {
+            return next;
+        }
+        if (data[next] == '"') {
+            inQuotes = !inQuotes;
+        } else if (!inQuotes) {
+            return next + 1;
+        }
+        pos = next + 1;
+    }
+}
+
+/**
+ * @brief Splits delimiter-separated text into records
+ */
+class RecordParser {
+public:
+    RecordParser(std::string_view data, char delimiter) noexcept : m_data(data), m_delimiter(delimiter) {
+    }
+
+    /**
+     * @brief Parse one record into a row
+     * @param pos Offset of the first byte of the record
+     * @param row Row receiving one cell per field
+     * @return Offset of the next record
+     */
+    size_t parse(size_t pos, Row& row) {
+        const size_t size = m_data.size();
+        for (;;) {
+            pos = pos < size && m_data[pos] == '"' ? parseQuoted(pos, row) : parseUnquoted(pos, row);
+            if (pos >= size) {
+                return size;
+            }
+
+            const char c = m_data[pos];
+            if (c == m_delimiter) {
+                if (++pos == size) {
+                    // A trailing delimiter ends with an empty field
+                    row.addCell(std::string_view{});
+                    return size;
+                }
+                continue;
+            }
+            if (c == '\r' && pos + 1 < size && m_data[pos + 1] == '\n') {
+                ++pos;
+            }
+            return pos + 1;
+        }
+    }
+
+private:
+    std::string_view m_data;
+    char m_delimiter;
+    std::string m_scratch;
+
+    size_t parseUnquoted(size_t pos, Row& row) {
+        const size_t end = findFieldEnd(m_data, pos, m_delimiter);
+        std::string_view field = m_data.substr(pos, end - pos);
+
+        // CRLF line endings: the CR belongs to the record end, not the field
+        if (!field.empty() && field.back() == '\r' && (end == m_data.size() || m_data[end] == '\n')) {
+            field.remove_suffix(1);
+        }
+        row.addCell(field);
+        return end;
+    }
+
+    size_t parseQuoted(size_t pos, Row& row) {
+        const size_t start = pos + 1;
+        size_t quote = m_data.find('"', start);
+        if (quote == std::string_view::npos) {
+            // Unterminated: the field runs to the end of the input
+            row.addCell(m_data.substr(start));
+            return m_data.size();
+        }
+
+        // Without doubled quotes the field is a plain slice of the input
+        std::string_view field = m_data.substr(start, quote - start);
+        pos = quote + 1;
+        if (pos < m_data.size() && m_data[pos] == '"') {
+            m_scratch.assign(m_data.substr(start, pos - start));
+            ++pos;
+            for (;;) {
+                quote = m_data.find('"', pos);
+                if (quote == std::string_view::npos) {
+                    m_scratch.append(m_data.substr(pos));
+                    pos = m_data.size();
+                    break;
+                }
+                m_scratch.append(m_data.substr(pos, quote - pos));
+                pos = quote + 1;
+                if (pos < m_data.size() && m_data[pos] == '"') {
+                    m_scratch.push_back('"');
+                    ++pos;
+                    continue;
+                }
+                break;
+            }
+            field = m_scratch;
+        }
+
+        // Text between the closing quote and the delimiter is kept, like most readers do
+        if (pos < m_data.size() && m_data[pos] != m_delimiter && m_data[pos] != '\n' && !isRecordEnd(pos)) {
+            size_t end = findFieldEnd(m_data, pos, m_delimiter);
+            std::string_view rest = m_data.substr(pos, end - pos);
+            if (!rest.empty() && rest.back() == '\r' && (end == m_data.size() || m_data[end] == '\n')) {
+                rest.remove_suffix(1);
+                --end;
+            }
+            if (field.data() != m_scratch.data()) {
+                m_scratch.assign(field);
+            }
+            m_scratch.append(rest);
+            field = m_scratch;
+            pos = end;
+        }
+
+        row.addCell(field);
+        return pos;
+    }
+
+    // A CR directly followed by LF or the end of the input
+    [[nodiscard]] bool isRecordEnd(size_t pos) const noexcept {
+        return m_data[pos] == '\r' && (pos + 1 == m_data.size() || m_data[pos + 1] == '\n');
+    }
+};
+
+/**
+ * @brief Check whether rows can be allocated concurrently from a memory resource
+ */
+bool isThreadSafe(const Table::allocator_type& alloc) noexcept {
+    return alloc.resource()->is_equal(*std::pmr::new_delete_resource());
+}
+
+} // namespace
+
+CsvImporter::CsvImporter(char delimiter) : m_delimiter(delimiter) {
+}
+
+Table CsvImporter::fromString(std::string_view data, const ImportOptions& options, const Table::allocator_type& alloc) const {
+    Table table(alloc);
+
+    if (data.starts_with("\xEF\xBB\xBF")) {
+        data.remove_prefix(3);
+    }
+    if (data.empty()) {
+        return table;
+    }
+
+    RecordParser parser(data, m_delimiter);
+    size_t pos = 0;
+    size_t columns = 0;
+    if (options.header) {
+        Row header;
+        pos = parser.parse(pos, header);
+        std::vector<std::string> headers;
+        headers.reserve(header.size());
+        for (const auto& cell : header.cells()) {
+            headers.emplace_back(cell.value());
+        }
+        table.addHeader(headers);
+        columns = headers.size();
+    }
+
+    // Records are split into blocks that threads parse independently
+    const size_t blockBytes = std::max<size_t>(options.bytesPerBlock, 1);
+    const size_t blocks = (data.size() - pos + blockBytes - 1) / blockBytes;
+    const unsigned threads = blocks > 1 ? static_cast<unsigned>(std::min<size_t>(resolveThreadCount(options.threads), blocks)) : 1;
+
+    auto parseSequentially = [&] {
+        table.reserveRows(countNewlines(data.substr(pos)) + 1);
+        while (pos < data.size()) {
+            Row row(table.get_allocator());
+            row.reserve(columns);
+            pos = parser.parse(pos, row);
+            columns = row.size();
+            table.addRow(std::move(row));
+        }
+        return std::move(table);
+    };
+    if (threads == 1) {
+        return parseSequentially();
+    }
+
+    // Quote parity at every block start tells whether it lies inside a quoted field
+    const size_t bodyStart = pos;
+    auto blockStart = [&](size_t index) { return std::min(bodyStart + index * blockBytes, data.size()); };
+    std::vector<size_t> quotes(blocks);
+    parallelFor(blocks, threads, [&](size_t index) {
+        quotes[index] = countQuotes(data.substr(blockStart(index), blockStart(index + 1) - blockStart(index)));
+    });
+
+    std::vector<size_t> starts(blocks + 1, data.size());
+    starts[0] = bodyStart;
+    std::vector<bool> inQuotes(blocks, false);
+    for (size_t index = 1; index < blocks; ++index) {
+        inQuotes[index] = inQuotes[index - 1] != (quotes[index - 1] % 2 == 1);
+    }
+    parallelFor(blocks - 1, threads, [&](size_t index) {
+        starts[index + 1] = findRecordStart(data, blockStart(index + 1), inQuotes[index + 1]);
+    });
+
+    // Parse every block into its own rows; arenas are not thread-safe, so those get copied in below
+    const Table::allocator_type blockAlloc = isThreadSafe(alloc) ? alloc : Table::allocator_type(std::pmr::new_delete_resource());
+    std::vector<std::vector<Row>> blockRows(blocks);
+    std::vector<size_t> ends(blocks);
+    parallelFor(blocks, threads, [&](size_t index) {
+        RecordParser blockParser(data, m_delimiter);
+        auto& rows = blockRows[index];
+        size_t blockColumns = columns;
+        size_t at = starts[index];
+        while (at < starts[index + 1]) {
+            Row row(blockAlloc);
+            row.reserve(blockColumns);
+            at = blockParser.parse(at, row);
+            blockColumns = row.size();
+            rows.push_back(std::move(row));
+        }
+        ends[index] = std::max(at, starts[index]);
+    });
+
+    // A stray quote inside an unquoted field (5" pipe) flips the parity without opening a quoted
+    // field. Blocks that end exactly where the next one starts prove every start a record
+    // boundary; otherwise the split was wrong and the input is parsed on one thread.
+    for (size_t index = 0; index < blocks; ++index) {
+        if (ends[index] != starts[index + 1]) {
+            blockRows = {};
+            return parseSequentially();
+        }
+    }
+
+    size_t rowCount = 0;
+    for (const auto& rows : blockRows) {
+        rowCount += rows.size();
+    }
+    table.reserveRows(rowCount);
+    for (auto& rows : blockRows) {
+        for (auto& row : rows) {
+            table.addRow(std::move(row));
+        }
+        rows = {};
+    }
+    return table;
+}
+
+Table CsvImporter::fromFile(const std::string& filename, const ImportOptions& options, const Table::allocator_type& alloc) const {
+    const MappedFile file(filename);
+    return fromString(file.data(), options, alloc);
+}
+
+} // namespace tabulix
@@ -0,0 +1,125 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation of the MappedFile class
+ */
+
+#include "tabulix/import/mapped_file.hpp"
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tabulix {
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), filename);
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+}
+
+void MappedFile::unmap() noexcept {
+    m_buffer.clear();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_buffer(std::move(other.m_buffer)) {
+    m_data = m_buffer.data();
+    m_size = std::exchange(other.m_size, 0);
+    other.m_data = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        m_buffer = std::move(other.m_buffer);
+        m_data = m_buffer.data();
+        m_size = std::exchange(other.m_size, 0);
+        other.m_data = nullptr;
+    }
+    return *this;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), filename);
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), filename);
+    }
+
+    // mmap(2) rejects empty mappings; an empty file is simply empty data
+    m_size = static_cast<size_t>(info.st_size);
+    if (m_size > 0) {
+        void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), filename);
+        }
+        m_data = static_cast<const char*>(mapping);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+}
+
+void MappedFile::unmap() noexcept {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+std::string_view MappedFile::data() const noexcept {
+    return {m_data, m_size};
+}
+
+size_t MappedFile::size() const noexcept {
+    return m_size;
+}
+
+} // namespace tabulix
@@ -0,0 +1,594 @@
+/**
+ * @file snapshot.cpp
+ * @brief Implementation of the binary table snapshot format
+ */
+
+#include "tabulix/import/snapshot.hpp"
+#include "../core/render_range.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace tabulix {
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'T', 'A', 'B', 'U', 'L', 'I', 'X', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrder = 0x01020304;
+constexpr uint32_t kHasHeader = 1;
+constexpr size_t kBorderStrings = 11;
+constexpr uint64_t kNoWidth = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief File header at offset 0
+ */
+struct SnapshotHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t columns;
+    uint64_t rows;          // Data rows, header excluded
+    uint32_t flags;
+    uint32_t theme;
+    uint64_t borderOffset;  // kBorderStrings SnapshotString records
+    uint64_t columnsOffset; // One SnapshotColumn per column
+    uint64_t recordsOffset; // Index of the first cell of every record, plus the cell count
+    uint64_t cellsOffset;   // One SnapshotCell per cell
+    uint64_t cellCount;
+    uint64_t stringsOffset; // Text of the border and the cells
+    uint64_t stringsSize;
+};
+
+/**
+ * @brief A string in the string section
+ */
+struct SnapshotString {
+    uint64_t offset;
+    uint64_t length;
+};
+
+/**
+ * @brief Layout and format of a column
+ */
+struct SnapshotColumn {
+    uint64_t width;      // Width the table renders the column with
+    uint64_t fixedWidth; // Width set with Table::setColumnWidth, or kNoWidth
+    uint32_t alignment;
+    int32_t precision;   // -1 if unset
+    char sign;
+    char type;
+    std::array<uint8_t, 6> padding;
+};
+
+/**
+ * @brief Kind of value held by a cell
+ */
+enum class CellKind : uint8_t {
+    TEXT,
+    INTEGER,
+    REAL
+};
+
+/**
+ * @brief A cell: a string of the string section or the bits of a number
+ */
+struct SnapshotCell {
+    uint64_t payload;  // String offset, int64_t or double bits
+    uint32_t length;   // String length
+    CellKind kind;
+    uint8_t alignment; // 0 if unset, else the Alignment plus one
+    std::array<uint8_t, 2> padding;
+};
+
+static_assert(sizeof(SnapshotHeader) == 96);
+static_assert(sizeof(SnapshotString) == 16);
+static_assert(sizeof(SnapshotColumn) == 32);
+static_assert(sizeof(SnapshotCell) == 16);
+
+template <typename T>
+void writeRecord(BufferedWriter& out, const T& record) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(std::string_view(reinterpret_cast<const char*>(&record), sizeof(T)));
+}
+
+// Reads with memcpy: a snapshot in a caller's buffer need not be aligned
+template <typename T>
+T readRecord(std::string_view data, size_t offset) noexcept {
+    T record;
+    std::memcpy(&record, data.data() + offset, sizeof(T));
+    return record;
+}
+
+[[noreturn]] void corrupt(const char* what) {
+    throw std::runtime_error(std::string("Invalid table snapshot: ") + what);
+}
+
+// Whether count records of a given size fit in the data from an 8-aligned offset
+bool sectionFits(uint64_t offset, uint64_t count, size_t recordSize, size_t dataSize) noexcept {
+    return offset % 8 == 0 && offset <= dataSize && count <= (dataSize - offset) / recordSize;
+}
+
+std::array<std::string_view, kBorderStrings> borderStrings(const Border& border) {
+    return {border.horizontal(), border.vertical(), border.topLeft(), border.topRight(),
+            border.bottomLeft(), border.bottomRight(), border.topIntersection(), border.bottomIntersection(),
+            border.leftIntersection(), border.rightIntersection(), border.crossIntersection()};
+}
+
+// Calls visit(cell) for every cell of the header and the data rows, in file order
+template <typename Visit>
+void forEachCell(const Table& table, Visit&& visit) {
+    if (table.header().has_value()) {
+        for (const auto& cell : table.header()->cells()) {
+            visit(cell);
+        }
+    }
+    for (const auto& row : table.rows()) {
+        for (const auto& cell : row.cells()) {
+            visit(cell);
+        }
+    }
+}
+
+} // namespace
+
+void writeSnapshot(const Table& table, BufferedWriter& out) {
+    const size_t columns = table.columnCount();
+    const auto border = borderStrings(table.border());
+    const auto widths = table.columnWidths();
+    const size_t records = table.rows().size() + (table.header().has_value() ? 1 : 0);
+
+    // Size the sections up front so every offset is known before the first byte is written
+    size_t cells = 0;
+    size_t strings = 0;
+    for (const auto text : border) {
+        strings += text.size();
+    }
+    forEachCell(table, [&](const Cell& cell) {
+        ++cells;
+        if (cell.isNumeric()) {
+            return;
+        }
+        if (cell.value().size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Cell too long for a table snapshot");
+        }
+        strings += cell.value().size();
+    });
+
+    SnapshotHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.byteOrder = kByteOrder;
+    header.columns = columns;
+    header.rows = table.rows().size();
+    header.flags = table.header().has_value() ? kHasHeader : 0;
+    header.theme = static_cast<uint32_t>(table.theme());
+    header.borderOffset = sizeof(SnapshotHeader);
+    header.columnsOffset = header.borderOffset + kBorderStrings * sizeof(SnapshotString);
+    header.recordsOffset = header.columnsOffset + columns * sizeof(SnapshotColumn);
+    header.cellsOffset = header.recordsOffset + (records + 1) * sizeof(uint64_t);
+    header.cellCount = cells;
+    header.stringsOffset = header.cellsOffset + cells * sizeof(SnapshotCell);
+    header.stringsSize = strings;
+
+    if (out.direct()) {
+        out.reserve(header.stringsOffset + header.stringsSize);
+    }
+    writeRecord(out, header);
+
+    uint64_t stringOffset = 0;
+    for (const auto text : border) {
+        writeRecord(out, SnapshotString{stringOffset, text.size()});
+        stringOffset += text.size();
+    }
+
+    for (size_t i = 0; i < columns; ++i) {
+        const FormatSpec& format = table.columnFormat(i);
+        SnapshotColumn column{};
+        column.width = widths[i];
+        column.fixedWidth = table.fixedColumnWidth(i).value_or(kNoWidth);
+        column.alignment = static_cast<uint32_t>(table.columnAlignment(i));
+        column.precision = format.precision.value_or(-1);
+        column.sign = format.sign;
+        column.type = format.type;
+        writeRecord(out, column);
+    }
+
+    uint64_t firstCell = 0;
+    if (table.header().has_value()) {
+        writeRecord(out, firstCell);
+        firstCell += table.header()->size();
+    }
+    for (const auto& row : table.rows()) {
+        writeRecord(out, firstCell);
+        firstCell += row.size();
+    }
+    writeRecord(out, firstCell);
+
+    forEachCell(table, [&](const Cell& cell) {
+        SnapshotCell record{};
+        const auto number = cell.number();
+        if (!number.has_value()) {
+            record.payload = stringOffset;
+            record.length = static_cast<uint32_t>(cell.value().size());
+            record.kind = CellKind::TEXT;
+            stringOffset += cell.value().size();
+        } else if (const auto* integer = std::get_if<int64_t>(&*number)) {
+            record.payload = static_cast<uint64_t>(*integer);
+            record.kind = CellKind::INTEGER;
+        } else {
+            record.payload = std::bit_cast<uint64_t>(std::get<double>(*number));
+            record.kind = CellKind::REAL;
+        }
+        if (cell.alignment().has_value()) {
+            record.alignment = static_cast<uint8_t>(static_cast<uint8_t>(*cell.alignment()) + 1);
+        }
+        writeRecord(out, record);
+    });
+
+    for (const auto text : border) {
+        out.write(text);
+    }
+    forEachCell(table, [&](const Cell& cell) {
+        if (!cell.isNumeric()) {
+            out.write(cell.value());
+        }
+    });
+}
+
+TableSnapshot TableSnapshot::fromFile(const std::string& filename) {
+    TableSnapshot snapshot;
+    snapshot.m_data = snapshot.m_file.emplace(filename).data();
+    snapshot.open();
+    return snapshot;
+}
+
+TableSnapshot TableSnapshot::fromString(std::string_view data) {
+    TableSnapshot snapshot;
+    snapshot.m_data = data;
+    snapshot.open();
+    return snapshot;
+}
+
+void TableSnapshot::open() {
+    if (m_data.size() < sizeof(SnapshotHeader)) {
+        corrupt("too short");
+    }
+    const auto header = readRecord<SnapshotHeader>(m_data, 0);
+    if (header.magic != kMagic) {
+        corrupt("bad magic");
+    }
+    if (header.version != kVersion) {
+        corrupt("unsupported version");
+    }
+    if (header.byteOrder != kByteOrder) {
+        corrupt("written with another byte order");
+    }
+    if (header.theme > static_cast<uint32_t>(Theme::FANCY)) {
+        corrupt("unknown theme");
+    }
+
+    const size_t size = m_data.size();
+    const bool hasHeader = (header.flags & kHasHeader) != 0;
+    if (header.rows >= size || !sectionFits(header.borderOffset, kBorderStrings, sizeof(SnapshotString), size)
+        || !sectionFits(header.columnsOffset, header.columns, sizeof(SnapshotColumn), size)
+        || !sectionFits(header.recordsOffset, header.rows + (hasHeader ? 2 : 1), sizeof(uint64_t), size)
+        || !sectionFits(header.cellsOffset, header.cellCount, sizeof(SnapshotCell), size)
+        || header.stringsOffset > size || header.stringsSize > size - header.stringsOffset) {
+        corrupt("section out of bounds");
+    }
+
+    m_columns = static_cast<size_t>(header.columns);
+    m_rows = static_cast<size_t>(header.rows);
+    m_hasHeader = hasHeader;
+    m_theme = static_cast<Theme>(header.theme);
+    m_recordsOffset = static_cast<size_t>(header.recordsOffset);
+    m_cellsOffset = static_cast<size_t>(header.cellsOffset);
+    m_cellCount = static_cast<size_t>(header.cellCount);
+    m_stringsOffset = static_cast<size_t>(header.stringsOffset);
+    m_stringsSize = static_cast<size_t>(header.stringsSize);
+
+    std::array<std::string, kBorderStrings> border;
+    for (size_t i = 0; i < kBorderStrings; ++i) {
+        const auto text = readRecord<SnapshotString>(m_data, header.borderOffset + i * sizeof(SnapshotString));
+        if (text.offset > m_stringsSize || text.length > m_stringsSize - text.offset) {
+            corrupt("border out of bounds");
+        }
+        border[i] = m_data.substr(m_stringsOffset + text.offset, text.length);
+    }
+    m_border = Border(border[0], border[1], border[2], border[3], border[4], border[5],
+                      border[6], border[7], border[8], border[9], border[10]);
+
+    m_widths.resize(m_columns);
+    m_fixedWidths.resize(m_columns);
+    m_alignments.resize(m_columns);
+    m_formats.resize(m_columns);
+    for (size_t i = 0; i < m_columns; ++i) {
+        const auto column = readRecord<SnapshotColumn>(m_data, header.columnsOffset + i * sizeof(SnapshotColumn));
+        if (column.alignment > static_cast<uint32_t>(Alignment::RIGHT)) {
+            corrupt("unknown column alignment");
+        }
+        m_widths[i] = static_cast<size_t>(column.width);
+        if (column.fixedWidth != kNoWidth) {
+            m_fixedWidths[i] = static_cast<size_t>(column.fixedWidth);
+        }
+        m_alignments[i] = static_cast<Alignment>(column.alignment);
+        m_formats[i].sign = column.sign;
+        m_formats[i].type = column.type;
+        if (column.precision >= 0) {
+            m_formats[i].precision = column.precision;
+        }
+    }
+}
+
+size_t TableSnapshot::rowCount() const noexcept {
+    return m_rows + (m_hasHeader ? 1 : 0);
+}
+
+size_t TableSnapshot::columnCount() const noexcept {
+    return m_columns;
+}
+
+bool TableSnapshot::hasHeader() const noexcept {
+    return m_hasHeader;
+}
+
+std::string_view TableSnapshot::header(size_t columnIndex) const {
+    if (!m_hasHeader) {
+        throw std::out_of_range("Table snapshot has no header");
+    }
+    const auto [first, count] = recordCells(0);
+    if (columnIndex >= count) {
+        throw std::out_of_range("Header cell index out of range");
+    }
+    return cellText(first + columnIndex);
+}
+
+size_t TableSnapshot::cellCount(size_t rowIndex) const {
+    if (rowIndex >= m_rows) {
+        throw std::out_of_range("Row index out of range");
+    }
+    return recordCells(rowIndex + (m_hasHeader ? 1 : 0)).second;
+}
+
+std::string_view TableSnapshot::value(size_t rowIndex, size_t columnIndex) const {
+    return cellText(dataCell(rowIndex, columnIndex));
+}
+
+std::optional<Cell::Number> TableSnapshot::number(size_t rowIndex, size_t columnIndex) const {
+    const auto cell = readRecord<SnapshotCell>(m_data, m_cellsOffset + dataCell(rowIndex, columnIndex) * sizeof(SnapshotCell));
+    switch (cell.kind) {
+        case CellKind::INTEGER:
+            return static_cast<int64_t>(cell.payload);
+        case CellKind::REAL:
+            return std::bit_cast<double>(cell.payload);
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<Alignment> TableSnapshot::alignment(size_t rowIndex, size_t columnIndex) const {
+    std::string buffer;
+    return viewCell(dataCell(rowIndex, columnIndex), buffer, {}).alignment;
+}
+
+Alignment TableSnapshot::columnAlignment(size_t columnIndex) const noexcept {
+    return columnIndex < m_alignments.size() ? m_alignments[columnIndex] : Alignment::LEFT;
+}
+
+const FormatSpec& TableSnapshot::columnFormat(size_t columnIndex) const noexcept {
+    static const FormatSpec kDefaultFormat;
+    return columnIndex < m_formats.size() ? m_formats[columnIndex] : kDefaultFormat;
+}
+
+const std::vector<size_t>& TableSnapshot::columnWidths() const noexcept {
+    return m_widths;
+}
+
+Theme TableSnapshot::theme() const noexcept {
+    return m_theme;
+}
+
+const Border& TableSnapshot::border() const noexcept {
+    return m_border;
+}
+
+Table TableSnapshot::toTable(const Table::allocator_type& alloc) const {
+    Table table(alloc);
+    std::string buffer;
+
+    if (m_hasHeader) {
+        const auto [first, count] = recordCells(0);
+        std::vector<std::string> headers;
+        headers.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            headers.emplace_back(cellText(first + i));
+        }
+        table.addHeader(headers);
+    }
+
+    table.reserveRows(m_rows);
+    for (size_t r = 0; r < m_rows; ++r) {
+        const auto [first, count] = recordCells(r + (m_hasHeader ? 1 : 0));
+        Row row(table.get_allocator());
+        row.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto cell = readRecord<SnapshotCell>(m_data, m_cellsOffset + (first + i) * sizeof(SnapshotCell));
+            if (cell.kind == CellKind::INTEGER) {
+                row.addCell(static_cast<int64_t>(cell.payload));
+            } else if (cell.kind == CellKind::REAL) {
+                row.addCell(std::bit_cast<double>(cell.payload));
+            } else {
+                row.addCell(viewCell(first + i, buffer, {}).text);
+            }
+            if (cell.alignment != 0) {
+                row[i].setAlignment(static_cast<Alignment>(cell.alignment - 1));
+            }
+        }
+        table.addRow(std::move(row));
+    }
+
+    // Formats first: they change the measured width of numeric cells
+    for (size_t i = 0; i < m_columns; ++i) {
+        const FormatSpec& format = m_formats[i];
+        std::string spec;
+        if (format.sign != '-') {
+            spec += format.sign;
+        }
+        if (format.precision.has_value()) {
+            spec += '.';
+            spec += std::to_string(*format.precision);
+        }
+        if (format.type != '\0') {
+            spec += format.type;
+        }
+        table.setColumnFormat(i, spec);
+        table.setColumnAlignment(i, m_alignments[i]);
+        table.setColumnWidth(i, m_fixedWidths[i]);
+    }
+    table.setTheme(m_theme);
+    table.setBorder(m_border);
+    return table;
+}
+
+std::string TableSnapshot::str(const RenderOptions& options) const {
+    std::string result;
+    BufferedWriter out(result);
+    render(out, options);
+    return result;
+}
+
+void TableSnapshot::renderTo(OutputSink& sink, const RenderOptions& options) const {
+    BufferedWriter out(sink);
+    render(out, options);
+    out.flush();
+}
+
+std::ostream& operator<<(std::ostream& os, const TableSnapshot& snapshot) {
+    StreamSink sink(os);
+    snapshot.renderTo(sink);
+    return os;
+}
+
+std::pair<size_t, size_t> TableSnapshot::recordCells(size_t record) const {
+    const auto first = readRecord<uint64_t>(m_data, m_recordsOffset + record * sizeof(uint64_t));
+    const auto last = readRecord<uint64_t>(m_data, m_recordsOffset + (record + 1) * sizeof(uint64_t));
+    if (first > last || last > m_cellCount) {
+        corrupt("row index out of bounds");
+    }
+    return {static_cast<size_t>(first), static_cast<size_t>(last - first)};
+}
+
+size_t TableSnapshot::dataCell(size_t rowIndex, size_t columnIndex) const {
+    if (rowIndex >= m_rows) {
+        throw std::out_of_range("Row index out of range");
+    }
+    const auto [first, count] = recordCells(rowIndex + (m_hasHeader ? 1 : 0));
+    if (columnIndex >= count) {
+        throw std::out_of_range("Cell index out of range");
+    }
+    return first + columnIndex;
+}
+
+std::string_view TableSnapshot::cellText(size_t cell) const {
+    if (readRecord<SnapshotCell>(m_data, m_cellsOffset + cell * sizeof(SnapshotCell)).kind != CellKind::TEXT) {
+        return {};
+    }
+    std::string unused;
+    return viewCell(cell, unused, {}).text;
+}
+
+CellView TableSnapshot::viewCell(size_t cell, std::string& buffer, const FormatSpec& format) const {
+    const auto record = readRecord<SnapshotCell>(m_data, m_cellsOffset + cell * sizeof(SnapshotCell));
+    if (record.alignment > static_cast<uint8_t>(Alignment::RIGHT) + 1) {
+        corrupt("unknown cell alignment");
+    }
+
+    CellView view;
+    if (record.alignment != 0) {
+        view.alignment = static_cast<Alignment>(record.alignment - 1);
+    }
+    switch (record.kind) {
+        case CellKind::TEXT:
+            if (record.payload > m_stringsSize || record.length > m_stringsSize - record.payload) {
+                corrupt("cell text out of bounds");
+            }
+            view.text = m_data.substr(m_stringsOffset + static_cast<size_t>(record.payload), record.length);
+            break;
+        case CellKind::INTEGER:
+            view.text = formatNumber(buffer, static_cast<int64_t>(record.payload), format);
+            break;
+        case CellKind::REAL:
+            view.text = formatNumber(buffer, std::bit_cast<double>(record.payload), format);
+            break;
+        default:
+            corrupt("unknown cell kind");
+    }
+    return view;
+}
+
+void TableSnapshot::render(BufferedWriter& out, const RenderOptions& options) const {
+    if (m_rows == 0 && !m_hasHeader) {
+        return;
+    }
+
+    const Border& border = options.border.has_value() ? *options.border : m_border;
+    const auto [firstColumn, columns] = clampRange(m_columns, options.columnOffset, options.columnLimit);
+    if (columns == 0) {
+        return;
+    }
+    const Renderer renderer(border, std::span(m_widths).subspan(firstColumn, columns),
+                            std::span(m_alignments).subspan(firstColumn, columns), options.overflow);
+
+    // Cells are viewed straight from the snapshot; only numbers need scratch space
+    std::vector<CellView> cells(columns);
+    std::vector<std::string> numbers(columns);
+    auto viewRecord = [&](size_t record) -> std::span<const CellView> {
+        const auto [first, count] = recordCells(record);
+        for (size_t i = 0; i < columns; ++i) {
+            const size_t column = firstColumn + i;
+            cells[i] = column < count ? viewCell(first + column, numbers[i], m_formats[column]) : CellView{};
+        }
+        return cells;
+    };
+
+    const auto [firstRow, rows] = clampRange(m_rows, options.rowOffset, options.rowLimit);
+    const size_t firstRecord = firstRow + (m_hasHeader ? 1 : 0);
+
+    // Rendering into a string: size it exactly so the output is allocated once
+    if (out.direct()) {
+        size_t size = renderer.bordersSize(m_hasHeader, rows);
+        if (m_hasHeader) {
+            size += renderer.rowSize(viewRecord(0));
+        }
+        for (size_t r = 0; r < rows; ++r) {
+            size += renderer.rowSize(viewRecord(firstRecord + r));
+        }
+        out.reserve(size);
+    }
+
+    renderer.writeTop(out);
+
+    if (m_hasHeader) {
+        renderer.writeRow(out, viewRecord(0));
+        renderer.writeHeaderSeparator(out);
+    }
+
+    for (size_t r = 0; r < rows; ++r) {
+        renderer.writeRow(out, viewRecord(firstRecord + r));
+
+        // Add row separator if not the last row
+        if (r + 1 < rows) {
+            renderer.writeRowSeparator(out);
+        }
+    }
+
+    renderer.writeBottom(out);
+}
+
+} // namespace tabulix
@@ -0,0 +1,194 @@
+/**
+ * @file columnar_table_tests.cpp
+ * @brief Tests for the ColumnarTable class
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+// The same text content as a Table and as a ColumnarTable
+std::pair<tabulix::Table, tabulix::ColumnarTable> sameTables(size_t rows) {
+    tabulix::Table table({"Id", "Text", "Note", "Wide header"});
+    tabulix::ColumnarTable columnar({"Id", "Text", "Note", "Wide header"});
+    for (size_t i = 0; i < rows; ++i) {
+        tabulix::Row row;
+        row.addCell(std::to_string(i));
+        row.addCell(i % 5 == 0 ? "two\nlines, \"quoted\"" : "one <line>");
+        if (i % 3 != 0) {
+            row.addCell(tabulix::Cell("x").setAlignment(tabulix::Alignment::RIGHT));
+        }
+        table.addRow(row);
+        columnar.addRow(row);
+    }
+    table.setColumnAlignment(1, tabulix::Alignment::CENTER);
+    columnar.setColumnAlignment(1, tabulix::Alignment::CENTER);
+    return {std::move(table), std::move(columnar)};
+}
+
+} // namespace
+
+TEST(ColumnarTableTest, EmptyTable) {
+    tabulix::ColumnarTable table;
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.rowCount(), 0);
+    EXPECT_EQ(table.columnCount(), 0);
+    EXPECT_EQ(table.str(), "");
+}
+
+TEST(ColumnarTableTest, CellAccess) {
+    tabulix::ColumnarTable table({"Name", "Value"});
+    table.addRow({"Alice", "28"});
+    table.addRow({"Bob"});
+
+    EXPECT_EQ(table.rowCount(), 3);
+    EXPECT_EQ(table.columnCount(), 2);
+    EXPECT_EQ(table.cell(0, 0), "Alice");
+    EXPECT_EQ(table.cell(0, 1), "28");
+    EXPECT_EQ(table.cell(1, 0), "Bob");
+    EXPECT_EQ(table.cell(1, 1), "");
+    EXPECT_THROW((void)table.cell(2, 0), std::out_of_range);
+    EXPECT_THROW((void)table.cell(0, 2), std::out_of_range);
+}
+
+TEST(ColumnarTableTest, MatchesTableOutput) {
+    tabulix::Table table({"Name", "Details", "Score"});
+    tabulix::ColumnarTable columnar({"Name", "Details", "Score"});
+
+    tabulix::Row custom;
+    custom.addCell("Carol");
+    custom.addCell(tabulix::Cell("centered").setAlignment(tabulix::Alignment::CENTER));
+
+    table.addRow({"Alice", "line1\nline2", "10"});
+    table.addRow({"Bob", "short"});
+    table.addRow(custom);
+    columnar.addRow({"Alice", "line1\nline2", "10"});
+    columnar.addRow({"Bob", "short"});
+    columnar.addRow(custom);
+
+    table.setColumnAlignment(2, tabulix::Alignment::RIGHT);
+    columnar.setColumnAlignment(2, tabulix::Alignment::RIGHT);
+
+    for (auto theme : {tabulix::Theme::GRID, tabulix::Theme::NONE, tabulix::Theme::MARKDOWN}) {
+        table.setTheme(theme);
+        columnar.setTheme(theme);
+        EXPECT_EQ(columnar.str(), table.str());
+    }
+
+    EXPECT_EQ(columnar.columnWidths(), table.columnWidths());
+    EXPECT_EQ(columnar.cellAlignment(2, 1), tabulix::Alignment::CENTER);
+    EXPECT_EQ(columnar.cellAlignment(0, 1), std::nullopt);
+}
+
+TEST(ColumnarTableTest, SetCellAlignment) {
+    tabulix::ColumnarTable table({"Value"});
+    table.addRow({"A"});
+    table.setColumnWidth(0, 5);
+    table.setCellAlignment(0, 0, tabulix::Alignment::RIGHT);
+
+    EXPECT_NE(table.str().find("|     A |"), std::string::npos);
+    EXPECT_THROW(table.setCellAlignment(1, 0, tabulix::Alignment::LEFT), std::out_of_range);
+}
+
+TEST(ColumnarTableTest, ClearAndStream) {
+    tabulix::ColumnarTable table({"Test"});
+    table.addRow({"Value"});
+
+    std::stringstream ss;
+    ss << table;
+    EXPECT_EQ(ss.str(), table.str());
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.rowCount(), 0);
+}
+
+TEST(ColumnarTableTest, RenderOptionsMatchTable) {
+    const auto [table, columnar] = sameTables(300);
+
+    const std::vector<tabulix::RenderOptions> options = {
+        {},
+        {.threads = 3, .rowsPerBlock = 7},
+        {.threads = 0, .rowsPerBlock = 64, .rowOffset = 10, .rowLimit = 100},
+        {.border = tabulix::getBorderForTheme(tabulix::Theme::UNICODE_SINGLE), .columnOffset = 1, .columnLimit = 2},
+        {.rowOffset = 290, .columnOffset = 4},
+        {.sampleRows = 3, .overflow = tabulix::Overflow::WRAP},
+    };
+    for (const auto& option : options) {
+        EXPECT_EQ(columnar.str(option), table.str(option));
+
+        std::string streamed;
+        tabulix::StringSink sink(streamed);
+        columnar.renderTo(sink, option);
+        EXPECT_EQ(streamed, table.str(option));
+    }
+}
+
+TEST(ColumnarTableTest, ExportersMatchTable) {
+    const auto [table, columnar] = sameTables(20);
+
+    for (const auto format : {tabulix::ExportFormat::TEXT, tabulix::ExportFormat::MARKDOWN, tabulix::ExportFormat::HTML,
+                              tabulix::ExportFormat::CSV, tabulix::ExportFormat::JSON}) {
+        const auto exporter = tabulix::Exporter::create(format);
+        EXPECT_EQ(exporter->toString(columnar), exporter->toString(table));
+
+        std::string streamed;
+        tabulix::StringSink sink(streamed);
+        exporter->toSink(columnar, sink);
+        EXPECT_EQ(streamed, exporter->toString(table));
+    }
+    for (const auto layout : {tabulix::JsonLayout::COLUMNAR, tabulix::JsonLayout::NDJSON}) {
+        EXPECT_EQ(tabulix::JsonExporter(layout).toString(columnar), tabulix::JsonExporter(layout).toString(table));
+    }
+
+    // Snapshots store the cells as they are held, so only their rendering is the same
+    const std::string snapshot = tabulix::BinaryExporter().toString(columnar);
+    EXPECT_EQ(tabulix::TableSnapshot::fromString(snapshot).str(), table.str());
+}
+
+TEST(ColumnarTableTest, CustomExporterGetsTableCopy) {
+    // An exporter written against Table alone still exports a ColumnarTable
+    class LinesExporter : public tabulix::Exporter {
+    public:
+        using tabulix::Exporter::toString;
+        std::string toString(const tabulix::Table& table) const override {
+            std::string result;
+            for (const auto& row : table.rows()) {
+                result += row.at(0).value();
+                result += '\n';
+            }
+            return result;
+        }
+    };
+
+    tabulix::ColumnarTable columnar({"Id"});
+    columnar.addRow({"a"}).addRow({"b"});
+    const LinesExporter exporter;
+    EXPECT_EQ(exporter.toString(columnar), "a\nb\n");
+
+    std::string streamed;
+    tabulix::StringSink sink(streamed);
+    static_cast<const tabulix::Exporter&>(exporter).toSink(columnar, sink);
+    EXPECT_EQ(streamed, "a\nb\n");
+}
+
+TEST(ColumnarTableTest, ToTable) {
+    auto [table, columnar] = sameTables(10);
+    columnar.setTheme(tabulix::Theme::UNICODE_SINGLE).setColumnWidth(1, 6);
+    table.setTheme(tabulix::Theme::UNICODE_SINGLE).setColumnWidth(1, 6);
+
+    const tabulix::Table copy = columnar.toTable();
+    EXPECT_EQ(copy.str(), table.str());
+    EXPECT_EQ(copy.fixedColumnWidth(1), 6u);
+    EXPECT_EQ(copy.rows()[1].at(2).alignment(), tabulix::Alignment::RIGHT);
+
+    tabulix::ColumnarTable headerless;
+    headerless.addRow({"a"}).addRow({"b", "c"});
+    EXPECT_EQ(headerless.toTable().str(), headerless.str());
+}
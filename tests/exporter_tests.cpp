@@ -6,7 +6,15 @@
 #include <gtest/gtest.h>
 #include <tabulix/tabulix.hpp>
 #include <tabulix/export/exporter.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
 
 TEST(ExporterTest, Factory) {
     // Test that the factory creates the correct exporter types
@@ -15,12 +23,14 @@ TEST(ExporterTest, Factory) {
     std::unique_ptr<tabulix::Exporter> htmlExporter = tabulix::Exporter::create(tabulix::ExportFormat::HTML);
     std::unique_ptr<tabulix::Exporter> csvExporter = tabulix::Exporter::create(tabulix::ExportFormat::CSV);
     std::unique_ptr<tabulix::Exporter> jsonExporter = tabulix::Exporter::create(tabulix::ExportFormat::JSON);
+    std::unique_ptr<tabulix::Exporter> binaryExporter = tabulix::Exporter::create(tabulix::ExportFormat::BINARY);
 
     EXPECT_NE(textExporter, nullptr);
     EXPECT_NE(markdownExporter, nullptr);
     EXPECT_NE(htmlExporter, nullptr);
     EXPECT_NE(csvExporter, nullptr);
     EXPECT_NE(jsonExporter, nullptr);
+    EXPECT_NE(binaryExporter, nullptr);
 }
 
 TEST(ExporterTest, TextExporter) {
@@ -63,3 +73,181 @@ TEST(ExporterTest, EmptyTable) {
     EXPECT_NO_THROW(csvExporter->toString(emptyTable));
     EXPECT_NO_THROW(jsonExporter->toString(emptyTable));
 }
+
+TEST(ExporterTest, CsvExporter) {
+    tabulix::Table table({"Name", "Note", "Count"});
+    table.addRow({"plain", "a field that is long enough for the vector scan", "1"});
+    table.addRow({"comma, inside", "say \"hi\"", "2"});
+    table.addRow({"multi\nline", "carriage\rreturn"});
+
+    const std::string expected =
+        "Name,Note,Count\r\n"
+        "plain,a field that is long enough for the vector scan,1\r\n"
+        "\"comma, inside\",\"say \"\"hi\"\"\",2\r\n"
+        "\"multi\nline\",\"carriage\rreturn\",\r\n";
+    EXPECT_EQ(tabulix::CsvExporter().toString(table), expected);
+
+    // Streaming produces the same bytes
+    std::string streamed;
+    tabulix::StringSink sink(streamed);
+    tabulix::CsvExporter().toSink(table, sink);
+    EXPECT_EQ(streamed, expected);
+
+    // A custom delimiter is quoted, commas are not
+    tabulix::Table semicolons({"a;b", "c,d"});
+    EXPECT_EQ(tabulix::CsvExporter(';').toString(semicolons), "\"a;b\";c,d\r\n");
+}
+
+TEST(ExporterTest, JsonExporter) {
+    tabulix::Table table({"Name", "Quote"});
+    table.addRow({"Alice", "say \"hi\"\n\ttab\\ and a long clean tail"});
+    table.addRow({"Bob", std::string("ctl\x01", 4)});
+
+    EXPECT_EQ(tabulix::JsonExporter().toString(table),
+              "[\n"
+              "{\"Name\":\"Alice\",\"Quote\":\"say \\\"hi\\\"\\n\\ttab\\\\ and a long clean tail\"},\n"
+              "{\"Name\":\"Bob\",\"Quote\":\"ctl\\u0001\"}\n"
+              "]\n");
+
+    EXPECT_EQ(tabulix::JsonExporter(tabulix::JsonLayout::COLUMNAR).toString(table),
+              "{\n"
+              "\"Name\":[\"Alice\",\"Bob\"],\n"
+              "\"Quote\":[\"say \\\"hi\\\"\\n\\ttab\\\\ and a long clean tail\",\"ctl\\u0001\"]\n"
+              "}\n");
+
+    // Without a header, keys are column indices
+    tabulix::Table plain;
+    plain.addRow({"x", "y"});
+    plain.addRow({"z"});
+    std::string streamed;
+    tabulix::StringSink sink(streamed);
+    tabulix::JsonExporter(tabulix::JsonLayout::NDJSON).toSink(plain, sink);
+    EXPECT_EQ(streamed, "{\"0\":\"x\",\"1\":\"y\"}\n{\"0\":\"z\",\"1\":\"\"}\n");
+
+    EXPECT_EQ(tabulix::JsonExporter().toString(tabulix::Table()), "[]\n");
+}
+
+TEST(ExporterTest, HtmlExporter) {
+    tabulix::Table table({"Item", "Price"});
+    table.setColumnAlignment(1, tabulix::Alignment::RIGHT);
+    table.addRow({"Fish & <Chips>", "4.50"});
+
+    tabulix::Row row({"\"Quoted\" 'text'\nsecond line", "1.00"});
+    row[0].setAlignment(tabulix::Alignment::CENTER);
+    table.addRow(row);
+
+    const std::string expected =
+        "<table>\n"
+        "<thead>\n"
+        "<tr><th>Item</th><th style=\"text-align: right\">Price</th></tr>\n"
+        "</thead>\n"
+        "<tbody>\n"
+        "<tr><td>Fish &amp; &lt;Chips&gt;</td><td style=\"text-align: right\">4.50</td></tr>\n"
+        "<tr><td style=\"text-align: center\">&quot;Quoted&quot; &#39;text&#39;<br>second line</td>"
+        "<td style=\"text-align: right\">1.00</td></tr>\n"
+        "</tbody>\n"
+        "</table>";
+    EXPECT_EQ(tabulix::HtmlExporter().toString(table), expected);
+
+    // The head arrives in its own chunk ahead of the body
+    std::vector<std::string> chunks;
+    tabulix::CallbackSink sink([&](std::string_view chunk) { chunks.emplace_back(chunk); });
+    tabulix::HtmlExporter().toSink(table, sink);
+    ASSERT_EQ(chunks.size(), 2u);
+    EXPECT_TRUE(chunks[0].ends_with("</thead>\n"));
+    EXPECT_EQ(chunks[0] + chunks[1], expected);
+}
+
+TEST(ExporterTest, MarkdownExporterMatchesMarkdownTheme) {
+    tabulix::Table table({"Col1", "Col2"});
+    table.addRow({"A", "B"});
+    const std::string original = table.str();
+
+    tabulix::Table themed = table;
+    themed.setTheme(tabulix::Theme::MARKDOWN);
+
+    const tabulix::MarkdownExporter exporter;
+    EXPECT_EQ(exporter.toString(table), themed.str());
+
+    std::string streamed;
+    tabulix::StringSink sink(streamed);
+    exporter.toSink(table, sink);
+    EXPECT_EQ(streamed, themed.str());
+
+    // The exported table keeps its own style
+    EXPECT_EQ(table.str(), original);
+}
+
+TEST(ExporterTest, ToFileReportsBytesAndErrors) {
+    tabulix::Table table({"Id", "Name"});
+    for (int i = 0; i < 50000; ++i) {
+        table.addRow({std::to_string(i), "name " + std::to_string(i)});
+    }
+
+    const tabulix::CsvExporter exporter;
+    const auto path = std::filesystem::temp_directory_path() / "tabulix_export_test.csv";
+    const tabulix::ExportResult result = exporter.toFile(table, path.string());
+    ASSERT_TRUE(result);
+
+    std::ifstream file(path, std::ios::binary);
+    const std::string written((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(written, exporter.toString(table));
+    EXPECT_EQ(result.bytesWritten, written.size());
+    std::filesystem::remove(path);
+
+    const auto missing = std::filesystem::temp_directory_path() / "tabulix_missing_dir" / "out.csv";
+    const tabulix::ExportResult failed = exporter.toFile(table, missing.string());
+    EXPECT_FALSE(failed);
+    EXPECT_EQ(failed.error, std::errc::no_such_file_or_directory);
+    EXPECT_EQ(failed.bytesWritten, 0u);
+
+    // Callers written when toFile returned bool still compile
+    const bool ok = exporter.toFile(table, missing.string());
+    EXPECT_FALSE(ok);
+
+    // A failed write is reported like a failed open
+    if (std::filesystem::exists("/dev/full")) {
+        const tabulix::ExportResult full = exporter.toFile(table, "/dev/full");
+        EXPECT_EQ(full.error, std::errc::no_space_on_device);
+    }
+}
+
+TEST(ExporterTest, ToFileLetsOtherErrorsPropagate) {
+    // An exporter bug is not an I/O failure and must not be reported as one
+    class FailingExporter : public tabulix::CsvExporter {
+    public:
+        using tabulix::CsvExporter::toSink;
+        void toSink(const tabulix::Table&, tabulix::OutputSink&) const override {
+            throw std::invalid_argument("unsupported table");
+        }
+    };
+
+    tabulix::Table table({"Id"});
+    const auto path = std::filesystem::temp_directory_path() / "tabulix_failing_export.csv";
+    EXPECT_THROW((void)FailingExporter().toFile(table, path.string()), std::invalid_argument);
+
+    // Neither is a system error that does not come from the file, like a thread failing to start
+    class ThreadlessExporter : public tabulix::CsvExporter {
+    public:
+        using tabulix::CsvExporter::toSink;
+        void toSink(const tabulix::Table&, tabulix::OutputSink& sink) const override {
+            sink.write("Id\n");
+            throw std::system_error(std::make_error_code(std::errc::resource_unavailable_try_again), "thread");
+        }
+    };
+    EXPECT_THROW((void)ThreadlessExporter().toFile(table, path.string()), std::system_error);
+    std::filesystem::remove(path);
+}
+
+TEST(ExporterTest, NumericCells) {
+    tabulix::Table table({"Name", "Score"});
+    table.setColumnFormat(1, ".1f");
+    table.emplaceRow("a", 1.25);
+    table.emplaceRow("b", std::numeric_limits<double>::quiet_NaN());
+    table.emplaceRow("c", 7);
+
+    EXPECT_EQ(tabulix::CsvExporter().toString(table), "Name,Score\r\na,1.2\r\nb,nan\r\nc,7.0\r\n");
+    EXPECT_EQ(tabulix::JsonExporter(tabulix::JsonLayout::NDJSON).toString(table),
+              "{\"Name\":\"a\",\"Score\":1.25}\n{\"Name\":\"b\",\"Score\":null}\n{\"Name\":\"c\",\"Score\":7}\n");
+    EXPECT_NE(tabulix::HtmlExporter().toString(table).find("<td>7.0</td>"), std::string::npos);
+}
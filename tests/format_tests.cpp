@@ -0,0 +1,95 @@
+/**
+ * @file format_tests.cpp
+ * @brief Tests for typed cells and numeric formatting
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+template <typename T>
+std::string format(T value, std::string_view spec) {
+    std::string buffer;
+    return std::string(tabulix::Cell(value).format(buffer, tabulix::FormatSpec::parse(spec)));
+}
+
+} // namespace
+
+TEST(FormatTest, ParseSpec) {
+    const auto spec = tabulix::FormatSpec::parse("+.3f");
+    EXPECT_EQ(spec.sign, '+');
+    EXPECT_EQ(spec.precision, 3);
+    EXPECT_EQ(spec.type, 'f');
+
+    EXPECT_EQ(tabulix::FormatSpec::parse("").type, '\0');
+    EXPECT_THROW(static_cast<void>(tabulix::FormatSpec::parse(".f")), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(tabulix::FormatSpec::parse("q")), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(tabulix::FormatSpec::parse("10d")), std::invalid_argument);
+}
+
+TEST(FormatTest, FormatsNumbers) {
+    EXPECT_EQ(format(42, ""), "42");
+    EXPECT_EQ(format(-42, "+"), "-42");
+    EXPECT_EQ(format(42, "+"), "+42");
+    EXPECT_EQ(format(255, "X"), "FF");
+    EXPECT_EQ(format(5, "b"), "101");
+    EXPECT_EQ(format(3, ".2f"), "3.00");
+    EXPECT_EQ(format(0.1, ""), "0.1");
+    EXPECT_EQ(format(3.14159, ".2f"), "3.14");
+    EXPECT_EQ(format(1234.5, ".1e"), "1.2e+03");
+    EXPECT_EQ(format(2.5, " "), " 2.5");
+    EXPECT_EQ(format(1e300, ".2f").size(), 304u);
+    EXPECT_EQ(format(std::numeric_limits<int64_t>::min(), ""), "-9223372036854775808");
+}
+
+TEST(FormatTest, NumericCells) {
+    tabulix::Cell cell(7.25);
+    EXPECT_TRUE(cell.isNumeric());
+    EXPECT_EQ(std::get<double>(*cell.number()), 7.25);
+    EXPECT_EQ(cell.value(), "");
+    EXPECT_EQ(cell.text(), "7.25");
+    EXPECT_EQ(cell.text(tabulix::FormatSpec::parse(".1f")), "7.2");
+    EXPECT_EQ(cell.width(), 4u);
+    EXPECT_EQ(cell.width(tabulix::FormatSpec::parse(".3f")), 5u);
+
+    cell.setValue("text");
+    EXPECT_FALSE(cell.isNumeric());
+    EXPECT_EQ(cell.value(), "text");
+    EXPECT_EQ(cell.text(tabulix::FormatSpec::parse(".1f")), "text");
+
+    cell.setValue(int64_t{12});
+    EXPECT_EQ(std::get<int64_t>(*cell.number()), 12);
+}
+
+TEST(FormatTest, TableFormatsColumnsLazily) {
+    tabulix::Table table({"Metric", "Value", "Count"});
+    table.setColumnAlignment(1, tabulix::Alignment::RIGHT);
+    table.emplaceRow("latency", 12.3456, 1500);
+    table.emplaceRow("errors", 0.5, 3);
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{7, 7, 5}));
+
+    // Changing the format re-measures the column
+    table.setColumnFormat(1, ".2f");
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{7, 5, 5}));
+
+    const std::string expected =
+        "+---------+-------+-------+\n"
+        "| Metric  | Value | Count |\n"
+        "+---------+-------+-------+\n"
+        "| latency | 12.35 | 1500  |\n"
+        "+---------+-------+-------+\n"
+        "| errors  |  0.50 | 3     |\n"
+        "+---------+-------+-------+\n";
+    EXPECT_EQ(table.str(), expected);
+    EXPECT_EQ(table.str({.threads = 2, .rowsPerBlock = 1}), expected);
+
+    tabulix::Table numbers;
+    numbers.addRow(std::vector<double>{1.5, 2.25});
+    EXPECT_EQ(numbers.columnWidths(), (std::vector<size_t>{3, 4}));
+    EXPECT_THROW(numbers.setColumnFormat(0, "%"), std::invalid_argument);
+}
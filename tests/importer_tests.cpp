@@ -0,0 +1,130 @@
+/**
+ * @file importer_tests.cpp
+ * @brief Tests for the CsvImporter class
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <filesystem>
+#include <memory_resource>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+std::vector<std::vector<std::string>> cellsOf(const tabulix::Table& table) {
+    std::vector<std::vector<std::string>> cells;
+    for (const auto& row : table.rows()) {
+        auto& values = cells.emplace_back();
+        for (const auto& cell : row.cells()) {
+            values.emplace_back(cell.value());
+        }
+    }
+    return cells;
+}
+
+std::vector<std::string> headerOf(const tabulix::Table& table) {
+    std::vector<std::string> values;
+    if (table.header().has_value()) {
+        for (const auto& cell : table.header()->cells()) {
+            values.emplace_back(cell.value());
+        }
+    }
+    return values;
+}
+
+tabulix::Table trickyTable() {
+    tabulix::Table table({"Id", "Text", "Note"});
+    for (int i = 0; i < 500; ++i) {
+        const std::string id = std::to_string(i);
+        switch (i % 5) {
+            case 0: table.addRow({id, "plain", ""}); break;
+            case 1: table.addRow({id, "with, comma", "say \"hi\""}); break;
+            case 2: table.addRow({id, "two\nlines", "\"\""}); break;
+            case 3: table.addRow({id, "carriage\r\nreturn", "a longer field that spans more than one SIMD block"}); break;
+            default: table.addRow({id, "", "end"}); break;
+        }
+    }
+    return table;
+}
+
+} // namespace
+
+TEST(ImporterTest, RoundTripsCsvExport) {
+    const auto table = trickyTable();
+    const std::string csv = tabulix::CsvExporter().toString(table);
+
+    const auto imported = tabulix::CsvImporter().fromString(csv);
+    EXPECT_EQ(headerOf(imported), headerOf(table));
+    EXPECT_EQ(cellsOf(imported), cellsOf(table));
+    EXPECT_EQ(imported.str(), table.str());
+}
+
+TEST(ImporterTest, TsvWithoutHeader) {
+    const auto table = tabulix::CsvImporter('\t').fromString("a\tb\nc\td\te\n", {.header = false});
+    EXPECT_FALSE(table.header().has_value());
+    EXPECT_EQ(cellsOf(table), (std::vector<std::vector<std::string>>{{"a", "b"}, {"c", "d", "e"}}));
+}
+
+TEST(ImporterTest, LenientInput) {
+    const tabulix::CsvImporter importer;
+    const auto table = importer.fromString("\xEF\xBB\xBFh1,h2\r\nx,\r\n\"q\"tail,\"open\nend");
+
+    EXPECT_EQ(headerOf(table), (std::vector<std::string>{"h1", "h2"}));
+    EXPECT_EQ(cellsOf(table), (std::vector<std::vector<std::string>>{{"x", ""}, {"qtail", "open\nend"}}));
+    EXPECT_EQ(cellsOf(importer.fromString("a,b\nlast,row")), (std::vector<std::vector<std::string>>{{"last", "row"}}));
+    EXPECT_EQ(cellsOf(importer.fromString("a,b\n1,")), (std::vector<std::vector<std::string>>{{"1", ""}}));
+    EXPECT_TRUE(importer.fromString("").empty());
+}
+
+TEST(ImporterTest, ParallelMatchesSequential) {
+    const auto table = trickyTable();
+    const std::string csv = tabulix::CsvExporter().toString(table);
+    const tabulix::CsvImporter importer;
+    const auto expected = cellsOf(importer.fromString(csv));
+
+    // Small blocks put boundaries inside quoted fields and line breaks
+    for (const unsigned threads : {2u, 3u, 0u}) {
+        for (const size_t bytesPerBlock : {size_t{1}, size_t{7}, size_t{64}, size_t{4096}}) {
+            const tabulix::ImportOptions options{.threads = threads, .bytesPerBlock = bytesPerBlock};
+            EXPECT_EQ(cellsOf(importer.fromString(csv, options)), expected);
+        }
+    }
+
+    // Cells end up in the table's arena whatever the thread count
+    std::pmr::monotonic_buffer_resource arena;
+    const auto pooled = importer.fromString(csv, {.threads = 4, .bytesPerBlock = 256}, &arena);
+    EXPECT_EQ(cellsOf(pooled), expected);
+    EXPECT_EQ(pooled.rows()[0][1].get_allocator().resource(), &arena);
+}
+
+TEST(ImporterTest, ParallelStrayQuotesMatchSequential) {
+    // A bare quote inside an unquoted field is text, not the start of a quoted field; it flips
+    // the quote parity, so the line breaks inside the quoted fields below look like record ends
+    std::string csv = "size,name\n5\" pipe,x\n";
+    for (int i = 0; i < 200; ++i) {
+        csv += "\"multi\nline " + std::to_string(i) + "\",y\n";
+    }
+    const tabulix::CsvImporter importer;
+    const auto expected = cellsOf(importer.fromString(csv));
+    ASSERT_EQ(expected.size(), 201u);
+    EXPECT_EQ(expected[0], (std::vector<std::string>{"5\" pipe", "x"}));
+    EXPECT_EQ(expected[1], (std::vector<std::string>{"multi\nline 0", "y"}));
+
+    for (const size_t bytesPerBlock : {size_t{1}, size_t{13}, size_t{100}, size_t{1000}}) {
+        EXPECT_EQ(cellsOf(importer.fromString(csv, {.threads = 3, .bytesPerBlock = bytesPerBlock})), expected);
+    }
+}
+
+TEST(ImporterTest, FromFile) {
+    const auto table = trickyTable();
+    const auto path = std::filesystem::temp_directory_path() / "tabulix_import_test.csv";
+    ASSERT_TRUE(tabulix::CsvExporter().toFile(table, path.string()));
+
+    const auto imported = tabulix::CsvImporter().fromFile(path.string(), {.threads = 2, .bytesPerBlock = 1024});
+    EXPECT_EQ(cellsOf(imported), cellsOf(table));
+    std::filesystem::remove(path);
+
+    EXPECT_THROW((void)tabulix::CsvImporter().fromFile(path.string()), std::system_error);
+}
@@ -0,0 +1,195 @@
+/**
+ * @file live_table_tests.cpp
+ * @brief Tests for the LiveTable class
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Minimal terminal understanding the sequences LiveTable emits
+ *
+ * Text overwrites the line under the cursor from the cursor column and
+ * leaves the rest of a longer line on screen, as a real terminal does.
+ */
+class Terminal : public tabulix::OutputSink {
+public:
+    void write(std::string_view data) override {
+        ++m_writes;
+        m_lastFrame = data;
+        while (!data.empty()) {
+            if (data.starts_with("\x1b[")) {
+                const size_t end = data.find_first_of("EFJK");
+                const std::string_view count = data.substr(2, end - 2);
+                const size_t n = count.empty() ? 0 : std::stoul(std::string(count));
+                switch (data[end]) {
+                    case 'F': m_row -= n; m_column = 0; break;
+                    case 'E': m_row += n; m_column = 0; break;
+                    case 'J': m_lines.resize(m_row); break;
+                    case 'K':
+                        if (m_row < m_lines.size() && m_lines[m_row].size() > m_column) {
+                            m_lines[m_row].resize(m_column);
+                        }
+                        break;
+                }
+                data.remove_prefix(end + 1);
+                continue;
+            }
+            if (data.front() == '\n') {
+                ++m_row;
+                m_column = 0;
+                data.remove_prefix(1);
+                continue;
+            }
+            const size_t end = std::min(data.find_first_of("\n\x1b"), data.size());
+            if (m_lines.size() <= m_row) {
+                m_lines.resize(m_row + 1);
+            }
+            std::string& line = m_lines[m_row];
+            line.resize(std::max(line.size(), m_column + end));
+            line.replace(m_column, end, data.substr(0, end));
+            m_column += end;
+            data.remove_prefix(end);
+        }
+    }
+
+    [[nodiscard]] std::string screen() const {
+        std::string result;
+        for (const auto& line : m_lines) {
+            result += line + "\n";
+        }
+        return result;
+    }
+
+    [[nodiscard]] size_t row() const noexcept { return m_row; }
+    [[nodiscard]] size_t writes() const noexcept { return m_writes; }
+    [[nodiscard]] const std::string& lastFrame() const noexcept { return m_lastFrame; }
+
+private:
+    std::vector<std::string> m_lines;
+    std::string m_lastFrame;
+    size_t m_row = 0;
+    size_t m_column = 0;
+    size_t m_writes = 0;
+};
+
+} // namespace
+
+TEST(LiveTableTest, FirstRedrawPrintsTable) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"alpha", "up"}).addRow({"beta", "down"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.lastFrame(), live.table().str());
+    EXPECT_EQ(terminal.row(), 7);
+
+    // Nothing changed: nothing is written
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.writes(), 1);
+}
+
+TEST(LiveTableTest, RewritesOnlyChangedRows) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"alpha", "up"}).addRow({"beta", "down"}).addRow({"gamma", "up"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+
+    live.setValue(1, 1, "up");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), live.table().str());
+    EXPECT_EQ(terminal.lastFrame(), "\x1b[4F| beta  | up     |\n\x1b[3E");
+    EXPECT_EQ(terminal.row(), 9);
+}
+
+TEST(LiveTableTest, AppendsRowsAboveBottomBorder) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"alpha", "up"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+
+    live.addRow({"beta", "down"});
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), live.table().str());
+    EXPECT_EQ(terminal.lastFrame().find("Host"), std::string::npos);
+    EXPECT_EQ(terminal.row(), 7);
+}
+
+TEST(LiveTableTest, FullRedrawWhenColumnGrows) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"alpha", "up"}).addRow({"beta", "down"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+
+    live.setValue(0, 1, "degraded");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), live.table().str());
+    EXPECT_NE(terminal.lastFrame().find("Host"), std::string::npos);
+
+    // Shrinking keeps the wider column instead of redrawing everything
+    live.setValue(0, 1, "up");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.lastFrame().find("Host"), std::string::npos);
+    EXPECT_NE(terminal.screen().find("| alpha | up       |"), std::string::npos);
+
+    live.invalidate();
+    Terminal fresh;
+    live.redraw(fresh);
+    EXPECT_EQ(fresh.screen(), live.table().str());
+}
+
+TEST(LiveTableTest, RowChangingHeightReflowsBelow) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"alpha", "up"}).addRow({"beta", "down"}).addRow({"gamma", "up"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+
+    live.setValue(0, 1, "up\ndown");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), live.table().str());
+
+    live.setValue(0, 1, "down");
+    live.setValue(2, 0, "delta");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), live.table().str());
+    EXPECT_EQ(terminal.row(), 9);
+}
+
+TEST(LiveTableTest, FullRedrawErasesLongerLines) {
+    tabulix::LiveTable live(tabulix::Table({"Host", "Status"}));
+    live.addRow({"a-very-long-cell", "x"}).addRow({"beta", "up"});
+
+    Terminal terminal;
+    live.redraw(terminal);
+
+    // One column grows while the other shrinks: the shrinking one keeps its width
+    live.setValue(0, 0, "a");
+    live.setValue(1, 1, "degraded");
+    live.redraw(terminal);
+    tabulix::Table expected = live.table();
+    expected.setColumnWidth(0, 16);
+    EXPECT_EQ(terminal.screen(), expected.str());
+
+    // A theme without borders draws shorter lines over the grid
+    live.setTheme(tabulix::Theme::NONE);
+    live.redraw(terminal);
+    expected.setTheme(tabulix::Theme::NONE);
+    EXPECT_EQ(terminal.screen(), expected.str());
+    EXPECT_NE(terminal.lastFrame().find("\x1b[K\n"), std::string::npos);
+
+    // Incremental updates rewrite lines of the same width without erasing
+    live.setValue(1, 0, "gamma");
+    live.redraw(terminal);
+    EXPECT_EQ(terminal.screen(), expected.setValue(1, 0, "gamma").str());
+    EXPECT_EQ(terminal.lastFrame().find("\x1b[K"), std::string::npos);
+}
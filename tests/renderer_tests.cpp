@@ -0,0 +1,99 @@
+/**
+ * @file renderer_tests.cpp
+ * @brief Tests for the Renderer class
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string renderRow(const tabulix::Renderer& renderer, const std::vector<tabulix::CellView>& cells) {
+    std::string output;
+    tabulix::BufferedWriter out(output);
+    renderer.writeRow(out, cells);
+    return output;
+}
+
+} // namespace
+
+TEST(RendererTest, PadsAndAlignsCells) {
+    const tabulix::Border border = tabulix::Border::ascii();
+    const std::vector<size_t> widths{5, 5, 5};
+    const std::vector<tabulix::Alignment> alignments{
+        tabulix::Alignment::LEFT, tabulix::Alignment::CENTER, tabulix::Alignment::RIGHT};
+    const tabulix::Renderer renderer(border, widths, alignments);
+
+    EXPECT_EQ(renderRow(renderer, {{"ab"}, {"ab"}, {"ab"}}), "| ab    |  ab   |    ab |\n");
+    EXPECT_EQ(renderRow(renderer, {{"toolong"}, {"x", tabulix::Alignment::LEFT}}), "| toolo | x     |       |\n");
+}
+
+TEST(RendererTest, MultilineRows) {
+    const tabulix::Border border = tabulix::Border::none();
+    const std::vector<size_t> widths{3, 1};
+    const tabulix::Renderer renderer(border, widths, {});
+
+    EXPECT_EQ(renderRow(renderer, {{"a\nbb\n"}, {"c"}}), " a    c \n bb     \n");
+}
+
+TEST(RendererTest, WrapsOverflowingLines) {
+    const tabulix::Border border = tabulix::Border::ascii();
+    const std::vector<size_t> widths{3, 2};
+    const tabulix::Renderer renderer(border, widths, {}, tabulix::Overflow::WRAP);
+
+    EXPECT_EQ(renderRow(renderer, {{"abcdefg"}, {"xy"}}), "| abc | xy |\n| def |    |\n| g   |    |\n");
+    EXPECT_EQ(renderRow(renderer, {{"abcd\nef"}, {"日本"}}), "| abc | 日 |\n| d   | 本 |\n| ef  |    |\n");
+    // A character wider than its column is cut rather than wrapped forever
+    const std::vector<size_t> narrow{1};
+    const tabulix::Renderer narrowRenderer(border, narrow, {}, tabulix::Overflow::WRAP);
+    EXPECT_EQ(renderRow(narrowRenderer, {{"日a"}}), "|   |\n");
+}
+
+TEST(RendererTest, SizesMatchOutput) {
+    const std::vector<size_t> widths{4, 0, 7};
+    const std::vector<std::vector<tabulix::CellView>> rows{
+        {{"one"}, {""}, {"two\nlines"}},
+        {{"x"}},
+        {{"overflowing text"}, {"y"}, {"z\n\n"}},
+        {{"日本語"}, {"é"}, {"Zürich\n\U0001F600!"}},
+    };
+
+    for (const auto overflow : {tabulix::Overflow::TRUNCATE, tabulix::Overflow::WRAP})
+    for (const auto& border : {tabulix::Border::ascii(), tabulix::Border::unicodeDouble(), tabulix::Border::none()}) {
+        const tabulix::Renderer renderer(border, widths, {}, overflow);
+
+        std::string output;
+        tabulix::BufferedWriter out(output);
+        size_t expected = renderer.bordersSize(false, rows.size());
+
+        renderer.writeTop(out);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            const size_t before = output.size();
+            renderer.writeRow(out, rows[i]);
+            EXPECT_EQ(output.size() - before, renderer.rowSize(rows[i]));
+            expected += renderer.rowSize(rows[i]);
+            if (i < rows.size() - 1) {
+                renderer.writeRowSeparator(out);
+            }
+        }
+        renderer.writeBottom(out);
+
+        EXPECT_EQ(output.size(), expected);
+    }
+}
+
+TEST(RendererTest, MultiByteBorderLines) {
+    const tabulix::Border border = tabulix::Border::unicodeSingle();
+    const std::vector<size_t> widths{1, 2};
+    const tabulix::Renderer renderer(border, widths, {});
+
+    std::string output;
+    tabulix::BufferedWriter out(output);
+    renderer.writeTop(out);
+    renderer.writeRowSeparator(out);
+    renderer.writeBottom(out);
+
+    EXPECT_EQ(output, "┌───┬────┐\n├───┼────┤\n└───┴────┘\n");
+}
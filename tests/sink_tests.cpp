@@ -0,0 +1,112 @@
+/**
+ * @file sink_tests.cpp
+ * @brief Tests for output sinks and the buffered writer
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+TEST(SinkTest, BufferedWriterChunksOutput) {
+    std::vector<std::string> chunks;
+    tabulix::CallbackSink sink([&](std::string_view chunk) { chunks.emplace_back(chunk); });
+
+    tabulix::BufferedWriter writer(sink, 4);
+    writer.write("ab");
+    writer.write("cde");
+    writer.write(6, 'x');
+    writer.flush();
+
+    std::string joined;
+    for (const auto& chunk : chunks) {
+        EXPECT_LE(chunk.size(), 4u);
+        joined += chunk;
+    }
+    EXPECT_EQ(joined, "abcdexxxxxx");
+}
+
+TEST(SinkTest, RenderToMatchesStr) {
+    tabulix::Table table({"Name", "Value"});
+    for (int i = 0; i < 1000; ++i) {
+        table.addRow({"row" + std::to_string(i), "line1\nline2"});
+    }
+
+    size_t largestChunk = 0;
+    std::string rendered;
+    tabulix::CallbackSink sink([&](std::string_view chunk) {
+        largestChunk = std::max(largestChunk, chunk.size());
+        rendered.append(chunk);
+    });
+    table.renderTo(sink);
+
+    EXPECT_EQ(rendered, table.str());
+    EXPECT_LE(largestChunk, tabulix::BufferedWriter::kDefaultCapacity);
+}
+
+TEST(SinkTest, StreamSink) {
+    tabulix::Table table({"Test"});
+    table.addRow({"Value"});
+
+    std::ostringstream os;
+    tabulix::StreamSink sink(os);
+    table.renderTo(sink);
+
+    EXPECT_EQ(os.str(), table.str());
+}
+
+TEST(SinkTest, FileDescriptorSink) {
+    tabulix::Table table({"Test"});
+    table.addRow({"Value"});
+
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    tabulix::FileDescriptorSink sink(fileno(file));
+    table.renderTo(sink);
+
+    std::rewind(file);
+    std::string contents;
+    char buffer[256];
+    size_t read = 0;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.append(buffer, read);
+    }
+    std::fclose(file);
+
+    EXPECT_EQ(contents, table.str());
+}
+
+#if !defined(_WIN32)
+TEST(SinkTest, FileDescriptorSinkCountsPartialWrites) {
+    // A non-blocking pipe accepts part of a large chunk, then fails with EAGAIN
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    ASSERT_EQ(::fcntl(fds[1], F_SETFL, O_NONBLOCK), 0);
+    ASSERT_EQ(::fcntl(fds[0], F_SETFL, O_NONBLOCK), 0);
+
+    tabulix::FileDescriptorSink sink(fds[1]);
+    EXPECT_THROW(sink.write(std::string(16 * 1024 * 1024, 'x')), std::system_error);
+
+    size_t received = 0;
+    char buffer[4096];
+    ssize_t read = 0;
+    while ((read = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+        received += static_cast<size_t>(read);
+    }
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    EXPECT_GT(received, 0u);
+    EXPECT_EQ(sink.bytesWritten(), received);
+}
+#endif
@@ -0,0 +1,147 @@
+/**
+ * @file snapshot_tests.cpp
+ * @brief Tests for binary table snapshots
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+
+tabulix::Table styledTable() {
+    tabulix::Table table({"Name", "Count", "Ratio"});
+    table.emplaceRow("alpha", 12, 0.5);
+    table.emplaceRow("multi\nline", -3, 2.25);
+    table.addRow({"short"});
+    table.emplaceRow("", int64_t{1} << 40, 1e-9);
+    tabulix::Row row;
+    row.addCell(std::string_view("right"));
+    row.at(0).setAlignment(tabulix::Alignment::RIGHT);
+    table.addRow(row);
+
+    table.setTheme(tabulix::Theme::UNICODE_SINGLE);
+    table.setColumnAlignment(1, tabulix::Alignment::RIGHT);
+    table.setColumnFormat(2, "+.3f");
+    table.setColumnWidth(0, 12);
+    return table;
+}
+
+} // namespace
+
+TEST(SnapshotTest, RendersLikeTheTable) {
+    const tabulix::Table table = styledTable();
+    const std::string data = tabulix::BinaryExporter().toString(table);
+    const auto snapshot = tabulix::TableSnapshot::fromString(data);
+
+    EXPECT_EQ(snapshot.str(), table.str());
+    EXPECT_EQ(snapshot.rowCount(), table.rowCount());
+    EXPECT_EQ(snapshot.columnCount(), table.columnCount());
+    EXPECT_EQ(snapshot.columnWidths(), table.columnWidths());
+    EXPECT_EQ(snapshot.theme(), tabulix::Theme::UNICODE_SINGLE);
+
+    const tabulix::RenderOptions page{.border = tabulix::getBorderForTheme(tabulix::Theme::GRID), .rowOffset = 1,
+                                      .rowLimit = 2, .columnOffset = 1, .overflow = tabulix::Overflow::WRAP};
+    EXPECT_EQ(snapshot.str(page), table.str(page));
+}
+
+TEST(SnapshotTest, CellsAndStyling) {
+    const std::string data = tabulix::BinaryExporter().toString(styledTable());
+    const auto snapshot = tabulix::TableSnapshot::fromString(data);
+
+    ASSERT_TRUE(snapshot.hasHeader());
+    EXPECT_EQ(snapshot.header(2), "Ratio");
+    EXPECT_EQ(snapshot.value(1, 0), "multi\nline");
+    EXPECT_EQ(snapshot.value(0, 1), "");
+    EXPECT_EQ(snapshot.number(0, 1), tabulix::Cell::Number(int64_t{12}));
+    EXPECT_EQ(snapshot.number(3, 1), tabulix::Cell::Number(int64_t{1} << 40));
+    EXPECT_EQ(snapshot.number(1, 2), tabulix::Cell::Number(2.25));
+    EXPECT_EQ(snapshot.number(0, 0), std::nullopt);
+    EXPECT_EQ(snapshot.cellCount(2), 1u);
+    EXPECT_EQ(snapshot.alignment(4, 0), tabulix::Alignment::RIGHT);
+    EXPECT_EQ(snapshot.alignment(0, 0), std::nullopt);
+    EXPECT_EQ(snapshot.columnAlignment(1), tabulix::Alignment::RIGHT);
+    EXPECT_EQ(snapshot.columnFormat(2).sign, '+');
+    EXPECT_EQ(snapshot.columnFormat(2).precision, 3);
+    EXPECT_EQ(snapshot.columnFormat(2).type, 'f');
+
+    EXPECT_THROW((void)snapshot.value(2, 1), std::out_of_range);
+    EXPECT_THROW((void)snapshot.value(5, 0), std::out_of_range);
+}
+
+TEST(SnapshotTest, ToTableRoundTrips) {
+    tabulix::Table table = styledTable();
+    table.setBorder(tabulix::Border("~", "!", "1", "2", "3", "4", "5", "6", "7", "8", "9"));
+    const std::string data = tabulix::BinaryExporter().toString(table);
+    const auto snapshot = tabulix::TableSnapshot::fromString(data);
+
+    const tabulix::Table copy = snapshot.toTable();
+    EXPECT_EQ(copy.str(), table.str());
+    EXPECT_EQ(copy.fixedColumnWidth(0), 12u);
+    EXPECT_EQ(copy.fixedColumnWidth(1), std::nullopt);
+    EXPECT_EQ(copy.rows()[3].at(2).number(), tabulix::Cell::Number(1e-9));
+
+    // Writing the copy again gives the same bytes
+    EXPECT_EQ(tabulix::BinaryExporter().toString(copy), tabulix::BinaryExporter().toString(table));
+}
+
+TEST(SnapshotTest, EmptyAndHeaderless) {
+    const tabulix::Table empty;
+    const std::string emptyData = tabulix::BinaryExporter().toString(empty);
+    const auto emptySnapshot = tabulix::TableSnapshot::fromString(emptyData);
+    EXPECT_EQ(emptySnapshot.rowCount(), 0u);
+    EXPECT_EQ(emptySnapshot.str(), "");
+    EXPECT_THROW((void)emptySnapshot.header(0), std::out_of_range);
+
+    tabulix::Table headerless;
+    headerless.addRow({"a", "b"}).addRow({"c", "d"});
+    const std::string data = tabulix::BinaryExporter().toString(headerless);
+    const auto snapshot = tabulix::TableSnapshot::fromString(data);
+    EXPECT_FALSE(snapshot.hasHeader());
+    EXPECT_EQ(snapshot.value(1, 1), "d");
+    EXPECT_EQ(snapshot.str(), headerless.str());
+}
+
+TEST(SnapshotTest, FromFile) {
+    const tabulix::Table table = styledTable();
+    const auto path = std::filesystem::temp_directory_path() / "tabulix_snapshot_test.tbx";
+    const auto result = tabulix::Exporter::create(tabulix::ExportFormat::BINARY)->toFile(table, path.string());
+    ASSERT_TRUE(result);
+
+    {
+        const auto snapshot = tabulix::TableSnapshot::fromFile(path.string());
+        EXPECT_EQ(snapshot.str(), table.str());
+    }
+    std::filesystem::remove(path);
+
+    EXPECT_THROW((void)tabulix::TableSnapshot::fromFile(path.string()), std::system_error);
+}
+
+TEST(SnapshotTest, RejectsInvalidData) {
+    const std::string data = tabulix::BinaryExporter().toString(styledTable());
+
+    EXPECT_THROW((void)tabulix::TableSnapshot::fromString(""), std::runtime_error);
+    EXPECT_THROW((void)tabulix::TableSnapshot::fromString("name,count\n"), std::runtime_error);
+    EXPECT_THROW((void)tabulix::TableSnapshot::fromString(std::string_view(data).substr(0, data.size() - 1)),
+                 std::runtime_error);
+
+    std::string badMagic = data;
+    badMagic[0] = 'X';
+    EXPECT_THROW((void)tabulix::TableSnapshot::fromString(badMagic), std::runtime_error);
+
+    // A cell pointing past the string section is caught when it is read
+    std::string badCell = data;
+    uint64_t cellsOffset = 0;
+    std::memcpy(&cellsOffset, badCell.data() + 64, sizeof(cellsOffset));
+    const uint64_t pastEnd = badCell.size();
+    std::memcpy(badCell.data() + cellsOffset, &pastEnd, sizeof(pastEnd));
+    const auto snapshot = tabulix::TableSnapshot::fromString(badCell);
+    EXPECT_THROW((void)snapshot.header(0), std::runtime_error);
+    EXPECT_THROW((void)snapshot.str(), std::runtime_error);
+    EXPECT_EQ(snapshot.value(0, 0), "alpha");
+}
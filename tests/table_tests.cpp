@@ -5,7 +5,15 @@
 
 #include <gtest/gtest.h>
 #include <tabulix/tabulix.hpp>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory_resource>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 TEST(TableTest, EmptyTable) {
     tabulix::Table table;
@@ -85,3 +93,314 @@ TEST(TableTest, StreamOperator) {
     EXPECT_FALSE(ss.str().empty());
     EXPECT_EQ(ss.str(), table.str());
 }
+
+TEST(TableTest, MemoryResource) {
+    // Every allocation must come from the arena: the upstream resource refuses to allocate
+    std::array<std::byte, 64 * 1024> buffer{};
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    tabulix::Table table({"A header long enough to defeat SSO", "Value"}, &arena);
+    table.addRow({"A cell value long enough to defeat SSO", "1"});
+    table.addRow(std::vector<std::string>{"Another long cell value for the arena", "2"});
+
+    tabulix::Row row;
+    row.addCell("A row built outside the table and copied in");
+    table.addRow(row);
+
+    EXPECT_EQ(table.get_allocator().resource(), &arena);
+    EXPECT_EQ(table.rowCount(), 4);
+    EXPECT_NE(table.str().find("Another long cell value for the arena"), std::string::npos);
+}
+
+TEST(TableTest, ColumnWidthsTrackMutations) {
+    tabulix::Table table({"Name", "Description"});
+    table.addRow({"A", "short"});
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{4, 11}));
+
+    table.addRow({"Longer name", "multi\nline text"});
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{11, 11}));
+
+    // Shrinking the widest cell falls back to the next widest one
+    table.setValue(1, 0, "Mid name");
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{8, 11}));
+
+    table.setValue(0, 1, "a much longer description");
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{8, 25}));
+
+    // A narrower header no longer contributes its old width
+    table.addHeader({"N", "D"});
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{8, 25}));
+
+    EXPECT_THROW(table.setValue(2, 0, "x"), std::out_of_range);
+
+    table.clear();
+    EXPECT_TRUE(table.columnWidths().empty());
+}
+
+TEST(TableTest, ParallelRenderMatchesSequential) {
+    tabulix::Table table({"Id", "Text"});
+    for (int i = 0; i < 1000; ++i) {
+        table.addRow({std::to_string(i), i % 7 == 0 ? "two\nlines" : "one line"});
+    }
+    const std::string expected = table.str();
+
+    for (const unsigned threads : {2u, 3u, 0u}) {
+        for (const size_t rowsPerBlock : {size_t{1}, size_t{64}, size_t{999}, size_t{5000}}) {
+            const tabulix::RenderOptions options{threads, rowsPerBlock};
+            EXPECT_EQ(table.str(options), expected);
+
+            std::string streamed;
+            tabulix::StringSink sink(streamed);
+            table.renderTo(sink, options);
+            EXPECT_EQ(streamed, expected);
+        }
+    }
+}
+
+TEST(TableTest, ParallelRenderRethrowsSinkErrors) {
+    tabulix::Table table({"Id", "Text"});
+    for (int i = 0; i < 20000; ++i) {
+        table.addRow({std::to_string(i), "a row wide enough to fill the writer buffer quickly"});
+    }
+
+    size_t chunks = 0;
+    tabulix::CallbackSink sink([&](std::string_view) {
+        if (++chunks == 2) {
+            throw std::runtime_error("sink failed");
+        }
+    });
+    EXPECT_THROW(table.renderTo(sink, tabulix::RenderOptions{4, 16}), std::runtime_error);
+    EXPECT_EQ(chunks, 2u);
+}
+
+TEST(TableTest, ParallelForRethrows) {
+    std::vector<int> visited(100, 0);
+    tabulix::parallelFor(visited.size(), 4, [&](size_t i) { visited[i] += 1; });
+    EXPECT_EQ(std::count(visited.begin(), visited.end(), 1), 100);
+
+    EXPECT_THROW(tabulix::parallelFor(10, 4, [](size_t i) {
+        if (i == 7) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+}
+
+TEST(TableTest, MoveAwareRowConstruction) {
+    tabulix::Table table({"A", "B", "C"});
+    table.reserveRows(3).reserveColumns(3);
+    const tabulix::Row* storage = table.rows().data();
+
+    // Long enough to live on the heap rather than in the small string buffer
+    std::pmr::string moved(64, 'x');
+    const char* buffer = moved.data();
+    table.emplaceRow(std::move(moved), "literal", std::string("copied"));
+    EXPECT_EQ(table.rows()[0][0].value().data(), buffer);
+    EXPECT_EQ(table.rows()[0][1].value(), "literal");
+    EXPECT_EQ(table.rows()[0][2].value(), "copied");
+
+    tabulix::Row row;
+    std::pmr::string cell(64, 'y');
+    const char* rowBuffer = cell.data();
+    row.addCell(std::move(cell)).addCell(tabulix::Cell("b")).addCell("c");
+    table.addRow(std::move(row));
+    EXPECT_EQ(table.rows()[1][0].value().data(), rowBuffer);
+
+    table.addRow({"d", "e", "f"});
+    EXPECT_EQ(table.rows().data(), storage);
+    EXPECT_EQ(table.columnWidths(), (std::vector<size_t>{64, 7, 6}));
+}
+
+TEST(TableTest, PagedRendering) {
+    tabulix::Table table({"Id", "Name", "Score"});
+    table.setColumnAlignment(2, tabulix::Alignment::RIGHT);
+    for (int i = 0; i < 100; ++i) {
+        table.emplaceRow(std::to_string(i), std::string(static_cast<size_t>(i % 13), 'n'), i * 10);
+    }
+
+    // A page is the table restricted to its rows and columns, sized like the whole table
+    auto expectedPage = [&](size_t firstRow, size_t rows, size_t firstColumn, size_t columns) {
+        const auto widths = table.columnWidths();
+        tabulix::Table page;
+        std::vector<std::string> header;
+        for (size_t c = firstColumn; c < firstColumn + columns; ++c) {
+            header.emplace_back(table.header()->at(c).value());
+        }
+        page.addHeader(header);
+        for (size_t r = firstRow; r < firstRow + rows; ++r) {
+            tabulix::Row row;
+            for (size_t c = firstColumn; c < firstColumn + columns; ++c) {
+                row.addCell(table.rows()[r].at(c));
+            }
+            page.addRow(std::move(row));
+        }
+        for (size_t c = 0; c < columns; ++c) {
+            page.setColumnWidth(c, widths[firstColumn + c]);
+            page.setColumnAlignment(c, table.columnAlignment(firstColumn + c));
+        }
+        return page.str();
+    };
+
+    EXPECT_EQ(table.str({.rowOffset = 20, .rowLimit = 10}), expectedPage(20, 10, 0, 3));
+    EXPECT_EQ(table.str({.rowOffset = 95, .rowLimit = 10}), expectedPage(95, 5, 0, 3));
+    EXPECT_EQ(table.str({.rowOffset = 500}), expectedPage(0, 0, 0, 3));
+    EXPECT_EQ(table.str({.columnOffset = 1, .columnLimit = 1}), expectedPage(0, 100, 1, 1));
+    EXPECT_EQ(table.str({.rowOffset = 40, .rowLimit = 30, .columnOffset = 1}), expectedPage(40, 30, 1, 2));
+    EXPECT_EQ(table.str({.columnOffset = 3}), "");
+    EXPECT_EQ(table.str({.rowOffset = 0, .rowLimit = 100}), table.str());
+
+    const tabulix::RenderOptions parallel{.threads = 3, .rowsPerBlock = 4, .rowOffset = 10, .rowLimit = 25};
+    EXPECT_EQ(table.str(parallel), expectedPage(10, 25, 0, 3));
+}
+
+TEST(TableTest, SampledColumnWidths) {
+    tabulix::Table table({"Id", "Text"});
+    table.addRow({"1", "short"});
+    table.addRow({"2", "a much longer text"});
+    table.setColumnWidth(0, 4);
+
+    const tabulix::RenderOptions truncated{.sampleRows = 1};
+    EXPECT_EQ(table.str(truncated),
+              "+------+-------+\n"
+              "| Id   | Text  |\n"
+              "+------+-------+\n"
+              "| 1    | short |\n"
+              "+------+-------+\n"
+              "| 2    | a muc |\n"
+              "+------+-------+\n");
+
+    const tabulix::RenderOptions wrapped{.sampleRows = 1, .overflow = tabulix::Overflow::WRAP};
+    EXPECT_EQ(table.str(wrapped),
+              "+------+-------+\n"
+              "| Id   | Text  |\n"
+              "+------+-------+\n"
+              "| 1    | short |\n"
+              "+------+-------+\n"
+              "| 2    | a muc |\n"
+              "|      | h lon |\n"
+              "|      | ger t |\n"
+              "|      | ext   |\n"
+              "+------+-------+\n");
+
+    // Wrapping output goes through the same exact-size reservation as any other render
+    std::string streamed;
+    tabulix::StringSink sink(streamed);
+    table.renderTo(sink, wrapped);
+    EXPECT_EQ(streamed, table.str(wrapped));
+
+    EXPECT_EQ(table.str({.sampleRows = 2}), table.str());
+}
+
+namespace {
+
+std::vector<std::string> columnOf(const tabulix::Table& table, size_t column) {
+    std::vector<std::string> values;
+    std::string buffer;
+    for (const auto& row : table.rows()) {
+        values.emplace_back(column < row.size() ? row.at(column).format(buffer) : "<none>");
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(TableTest, SortByColumn) {
+    tabulix::Table table({"Name", "Size"});
+    table.emplaceRow("pear", "10");
+    table.emplaceRow("apple", 9);
+    table.emplaceRow("banana split", 2.5);
+    table.emplaceRow("banana bread", "n/a");
+    table.addRow({"kiwi"});
+    table.emplaceRow("apple", " +1e2 ");
+
+    table.sortBy(0);
+    EXPECT_EQ(columnOf(table, 0),
+              (std::vector<std::string>{"apple", "apple", "banana bread", "banana split", "kiwi", "pear"}));
+    // Stable: the two apples keep their order
+    EXPECT_EQ(columnOf(table, 1), (std::vector<std::string>{"9", " +1e2 ", "n/a", "2.5", "<none>", "10"}));
+
+    table.sortBy(1, {.key = tabulix::SortKey::NUMERIC});
+    EXPECT_EQ(columnOf(table, 1), (std::vector<std::string>{"2.5", "9", "10", " +1e2 ", "n/a", "<none>"}));
+
+    // Rows without a number stay last when descending
+    table.sortBy(1, {.key = tabulix::SortKey::NUMERIC, .descending = true});
+    EXPECT_EQ(columnOf(table, 1), (std::vector<std::string>{" +1e2 ", "10", "9", "2.5", "n/a", "<none>"}));
+
+    table.sortBy(0, [](const tabulix::Cell& a, const tabulix::Cell& b) { return a.value().size() < b.value().size(); });
+    EXPECT_EQ(columnOf(table, 0),
+              (std::vector<std::string>{"pear", "kiwi", "apple", "apple", "banana split", "banana bread"}));
+
+    EXPECT_EQ(table.columnWidths(), tabulix::Table(table).columnWidths());
+    EXPECT_EQ(table.header()->at(0).value(), "Name");
+    EXPECT_THROW(table.sortBy(2), std::out_of_range);
+}
+
+TEST(TableTest, SortByTextWithNulBytes) {
+    // Short texts are zero-padded in the sort key, so "a" and "a\0" share a prefix
+    using namespace std::string_view_literals;
+    tabulix::Table table({"Key"});
+    table.addRow({std::string("a\0"sv)});
+    table.addRow({std::string("a"sv)});
+    table.addRow({std::string("a\0\0"sv)});
+    table.addRow({std::string("\0"sv)});
+
+    table.sortBy(0);
+    EXPECT_EQ(columnOf(table, 0), (std::vector<std::string>{std::string("\0"sv), "a", std::string("a\0"sv),
+                                                            std::string("a\0\0"sv)}));
+
+    table.sortBy(0, {.descending = true});
+    EXPECT_EQ(columnOf(table, 0).front(), std::string("a\0\0"sv));
+    EXPECT_EQ(columnOf(table, 0).back(), std::string("\0"sv));
+}
+
+TEST(TableTest, ParallelSortMatchesSequential) {
+    tabulix::Table table({"Key", "Id"});
+    for (int i = 0; i < 5000; ++i) {
+        // Long shared prefixes force full-text comparisons, duplicates test stability
+        table.emplaceRow("common-prefix-" + std::to_string((i * 7919) % 613), i);
+    }
+
+    for (const auto key : {tabulix::SortKey::LEXICOGRAPHIC, tabulix::SortKey::NUMERIC}) {
+        const size_t column = key == tabulix::SortKey::NUMERIC ? 1 : 0;
+        tabulix::Table sequential = table;
+        sequential.sortBy(column, {.key = key, .descending = true});
+        tabulix::Table parallel = table;
+        parallel.sortBy(column, {.key = key, .descending = true, .threads = 4, .minParallelRows = 1});
+        EXPECT_EQ(parallel.str(), sequential.str());
+    }
+    tabulix::Table sorted = table;
+    sorted.sortBy(0, {.threads = 4, .minParallelRows = 1});
+    EXPECT_TRUE(std::ranges::is_sorted(columnOf(sorted, 0)));
+
+    std::vector<int> values(10007);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 104729) % 1000);
+    }
+    std::vector<int> expected = values;
+    std::ranges::sort(expected);
+    tabulix::parallelSort(values.begin(), values.end(), std::less<>(), 3, false);
+    EXPECT_EQ(values, expected);
+}
+
+TEST(TableTest, NumericSortKeepsLargeIntegersExact) {
+    constexpr int64_t kMax = std::numeric_limits<int64_t>::max();
+    tabulix::Table table({"Id"});
+    table.emplaceRow(kMax);
+    table.emplaceRow(int64_t{9007199254740993});
+    table.emplaceRow(kMax - 1);
+    table.emplaceRow("9007199254740992");
+    table.emplaceRow(0x1p63);
+    table.emplaceRow(std::numeric_limits<int64_t>::min());
+    table.emplaceRow(-0x1p63);
+    table.emplaceRow(kMax - 2);
+
+    table.sortBy(0, {.key = tabulix::SortKey::NUMERIC});
+    EXPECT_EQ(columnOf(table, 0),
+              (std::vector<std::string>{"-9223372036854775808", "-9223372036854775808", "9007199254740992", "9007199254740993",
+                                        "9223372036854775805", "9223372036854775806", "9223372036854775807",
+                                        "9223372036854775808"}));
+
+    table.sortBy(0, {.key = tabulix::SortKey::NUMERIC, .descending = true});
+    EXPECT_EQ(columnOf(table, 0).front(), "9223372036854775808");
+    EXPECT_EQ(columnOf(table, 0)[1], "9223372036854775807");
+    EXPECT_EQ(columnOf(table, 0)[2], "9223372036854775806");
+}
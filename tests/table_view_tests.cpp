@@ -0,0 +1,182 @@
+/**
+ * @file table_view_tests.cpp
+ * @brief Tests for the TableView class template
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <cctype>
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Trade {
+    std::string symbol;
+    double price;
+    int64_t volume;
+};
+
+const std::vector<Trade> kTrades = {
+    {"AAPL", 189.5, 1200},
+    {"MSFT", 411.25, 830},
+    {"NVDA", 1024.0, 45000},
+};
+
+tabulix::Table equivalentTable() {
+    tabulix::Table table({"Symbol", "Price", "Volume"});
+    for (const auto& trade : kTrades) {
+        table.emplaceRow(trade.symbol, trade.price, trade.volume);
+    }
+    table.setColumnAlignment(1, tabulix::Alignment::RIGHT);
+    table.setColumnAlignment(2, tabulix::Alignment::RIGHT);
+    table.setColumnFormat(1, ".2f");
+    return table;
+}
+
+} // namespace
+
+TEST(TableViewTest, MatchesEquivalentTable) {
+    tabulix::TableView view(kTrades,
+        tabulix::column("Symbol", &Trade::symbol),
+        tabulix::column("Price", &Trade::price, tabulix::Alignment::RIGHT, ".2f"),
+        tabulix::column("Volume", [](const Trade& t) { return t.volume; }, tabulix::Alignment::RIGHT));
+
+    const auto table = equivalentTable();
+    EXPECT_EQ(view.rowCount(), 3);
+    EXPECT_EQ(view.columnCount(), 3);
+    EXPECT_EQ(view.columnWidths(), table.columnWidths());
+    EXPECT_EQ(view.str(), table.str());
+
+    std::ostringstream os;
+    os << view;
+    EXPECT_EQ(os.str(), table.str());
+}
+
+TEST(TableViewTest, ThemesAndBorderOption) {
+    tabulix::TableView view(kTrades,
+        tabulix::column("Symbol", &Trade::symbol),
+        tabulix::column("Price", &Trade::price, tabulix::Alignment::RIGHT, ".2f"),
+        tabulix::column("Volume", &Trade::volume, tabulix::Alignment::RIGHT));
+
+    auto table = equivalentTable();
+    const auto markdown = tabulix::getBorderForTheme(tabulix::Theme::MARKDOWN);
+    EXPECT_EQ(view.str({.border = markdown}), table.str({.border = markdown}));
+
+    view.setTheme(tabulix::Theme::MINIMAL);
+    table.setTheme(tabulix::Theme::MINIMAL);
+    EXPECT_EQ(view.str(), table.str());
+}
+
+TEST(TableViewTest, ReflectsCurrentContents) {
+    std::list<std::string> names = {"a", "b"};
+    tabulix::TableView view(names,
+        tabulix::column("Name", [](const std::string& s) -> const std::string& { return s; }),
+        tabulix::column("Upper", [](const std::string& s) {
+            std::string upper = s;
+            for (auto& c : upper) {
+                c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
+            return upper;
+        }));
+
+    names.push_back("longer name");
+    tabulix::Table table({"Name", "Upper"});
+    table.addRow({"a", "A"});
+    table.addRow({"b", "B"});
+    table.addRow({"longer name", "LONGER NAME"});
+    EXPECT_EQ(view.str(), table.str());
+
+    std::ostringstream os;
+    tabulix::StreamSink sink(os);
+    view.renderTo(sink);
+    EXPECT_EQ(os.str(), table.str());
+}
+
+TEST(TableViewTest, EmptyRange) {
+    const std::vector<Trade> none;
+    tabulix::TableView view(none, tabulix::column("Symbol", &Trade::symbol));
+
+    tabulix::Table table({"Symbol"});
+    EXPECT_EQ(view.rowCount(), 0);
+    EXPECT_EQ(view.str(), table.str());
+}
+
+TEST(TableViewTest, SampledWidths) {
+    tabulix::TableView view(kTrades,
+        tabulix::column("Symbol", &Trade::symbol),
+        tabulix::column("Price", &Trade::price, tabulix::Alignment::RIGHT, ".2f"),
+        tabulix::column("Volume", &Trade::volume, tabulix::Alignment::RIGHT));
+
+    const auto table = equivalentTable();
+    for (const auto overflow : {tabulix::Overflow::TRUNCATE, tabulix::Overflow::WRAP}) {
+        const tabulix::RenderOptions options{.sampleRows = 1, .overflow = overflow};
+        EXPECT_EQ(view.str(options), table.str(options));
+    }
+}
+
+TEST(TableViewTest, OwnsTemporariesAndViews) {
+    // A temporary container is moved into the view instead of dangling
+    tabulix::TableView owned(std::vector<Trade>(kTrades), tabulix::column("Symbol", &Trade::symbol));
+    tabulix::Table all({"Symbol"});
+    for (const auto& trade : kTrades) {
+        all.addRow({trade.symbol});
+    }
+    EXPECT_EQ(owned.str(), all.str());
+
+    // Views that are not const-iterable render too, whether passed as lvalues or temporaries
+    auto isBusy = [](const Trade& t) { return t.volume > 1000; };
+    auto busy = kTrades | std::views::filter(isBusy);
+    tabulix::TableView referenced(busy, tabulix::column("Symbol", &Trade::symbol));
+    tabulix::TableView moved(kTrades | std::views::filter(isBusy), tabulix::column("Symbol", &Trade::symbol));
+
+    tabulix::Table table({"Symbol"});
+    table.addRow({"AAPL"});
+    table.addRow({"NVDA"});
+    EXPECT_EQ(referenced.rowCount(), 2);
+    EXPECT_EQ(referenced.str(), table.str());
+    EXPECT_EQ(moved.str(), table.str());
+}
+
+TEST(TableViewTest, CharactersAreText) {
+    const std::vector<Trade> trades = {{"AAPL", 1.0, 1}};
+    tabulix::TableView view(trades,
+        tabulix::column("Initial", [](const Trade& t) { return t.symbol[0]; }),
+        tabulix::column("Small", [](const Trade& t) { return static_cast<int8_t>(t.volume); }));
+
+    tabulix::Table table({"Initial", "Small"});
+    table.emplaceRow("A", 1);
+    EXPECT_EQ(view.str(), table.str());
+
+    static_assert(!tabulix::CellNumber<char> && !tabulix::CellNumber<char32_t>);
+    static_assert(tabulix::CellNumber<int8_t> && tabulix::CellNumber<uint8_t>);
+}
+
+TEST(TableViewTest, ProjectionsReturningOwnedStrings) {
+    // Strings returned by value are kept in the view's scratch buffers, not referenced after they die
+    tabulix::TableView view(kTrades,
+        tabulix::column("Lower", [](const Trade& t) {
+            std::pmr::string lower(t.symbol.begin(), t.symbol.end());
+            for (char& c : lower) {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+            lower.append(24, '.');
+            return lower;
+        }),
+        tabulix::column("Symbol", [](const Trade& t) { return t.symbol + std::string(24, '!'); }));
+
+    tabulix::Table table({"Lower", "Symbol"});
+    for (const auto& trade : kTrades) {
+        std::string lower;
+        for (const char c : trade.symbol) {
+            lower += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        table.addRow({lower + std::string(24, '.'), trade.symbol + std::string(24, '!')});
+    }
+    EXPECT_EQ(view.str(), table.str());
+}
@@ -0,0 +1,96 @@
+/**
+ * @file table_writer_tests.cpp
+ * @brief Tests for the TableWriter class
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::vector<std::string> kHeader = {"Time", "Event"};
+const std::vector<std::vector<std::string>> kRows = {
+    {"12:00", "connected"},
+    {"12:01", "message received"},
+    {"12:02", "disconnected by peer"},
+};
+
+tabulix::Table makeTable() {
+    tabulix::Table table(kHeader);
+    for (const auto& row : kRows) {
+        table.addRow(row);
+    }
+    return table;
+}
+
+} // namespace
+
+TEST(TableWriterTest, FixedWidthsWriteRowsImmediately) {
+    std::string output;
+    tabulix::StringSink sink(output);
+    tabulix::TableWriter writer(sink, kHeader, {5, 10});
+
+    writer.writeRow({"12:00", "connected"});
+    EXPECT_NE(output.find("connected"), std::string::npos);
+    writer.writeRow({"12:01", "message received"});
+    writer.writeRow({"12:02", "disconnected by peer"});
+    writer.finish();
+
+    auto table = makeTable();
+    table.setColumnWidth(0, 5).setColumnWidth(1, 10);
+    EXPECT_EQ(output, table.str());
+    EXPECT_EQ(writer.rowCount(), 3);
+    EXPECT_THROW(writer.writeRow({"late"}), std::logic_error);
+}
+
+TEST(TableWriterTest, SampledWidths) {
+    std::string output;
+    tabulix::StringSink sink(output);
+    {
+        tabulix::TableWriter writer(sink, kHeader, {.sampleRows = 2, .overflow = tabulix::Overflow::WRAP});
+        writer.writeRow({kRows[0][0], kRows[0][1]});
+        EXPECT_TRUE(output.empty());
+        EXPECT_TRUE(writer.columnWidths().empty());
+
+        writer.writeRow({kRows[1][0], kRows[1][1]});
+        EXPECT_FALSE(output.empty());
+        EXPECT_EQ(writer.columnWidths().size(), 2);
+
+        writer.writeRow({kRows[2][0], kRows[2][1]});
+        // The destructor finishes the table
+    }
+
+    EXPECT_EQ(output, makeTable().str({.sampleRows = 2, .overflow = tabulix::Overflow::WRAP}));
+}
+
+TEST(TableWriterTest, FinishCompletesShortSample) {
+    std::string output;
+    tabulix::StringSink sink(output);
+    tabulix::TableWriter writer(sink, kHeader, {.border = tabulix::getBorderForTheme(tabulix::Theme::MARKDOWN)});
+    writer.setColumnAlignment(0, tabulix::Alignment::RIGHT);
+
+    tabulix::Row row;
+    row.addCell("12:00").addCell(42);
+    writer.writeRow(row);
+    writer.finish();
+    writer.finish();
+
+    tabulix::Table table(kHeader);
+    table.addRow(row);
+    table.setColumnAlignment(0, tabulix::Alignment::RIGHT);
+    table.setTheme(tabulix::Theme::MARKDOWN);
+    EXPECT_EQ(output, table.str());
+}
+
+TEST(TableWriterTest, EmptyWriterWritesNothing) {
+    std::string output;
+    tabulix::StringSink sink(output);
+    tabulix::TableWriter(sink, {}, {3}).finish();
+    EXPECT_TRUE(output.empty());
+
+    tabulix::TableWriter(sink, kHeader).finish();
+    EXPECT_EQ(output, tabulix::Table(kHeader).str());
+}
@@ -0,0 +1,49 @@
+/**
+ * @file text_tests.cpp
+ * @brief Tests for the line scanning helpers
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <string>
+#include <string_view>
+
+TEST(TextTest, FindNewline) {
+    EXPECT_EQ(tabulix::findNewline(""), std::string_view::npos);
+    EXPECT_EQ(tabulix::findNewline("single line"), std::string_view::npos);
+    EXPECT_EQ(tabulix::findNewline("\n"), 0u);
+
+    // Newlines at every offset of the vector blocks and the scalar tail
+    for (size_t offset = 0; offset < 100; ++offset) {
+        std::string text(100, 'x');
+        text[offset] = '\n';
+        EXPECT_EQ(tabulix::findNewline(text), offset);
+    }
+}
+
+TEST(TextTest, CountNewlines) {
+    std::string text(77, 'x');
+    for (size_t offset = 0; offset < text.size(); offset += 5) {
+        text[offset] = '\n';
+    }
+    EXPECT_EQ(tabulix::countNewlines(text), 16u);
+    EXPECT_EQ(tabulix::countNewlines(""), 0u);
+}
+
+TEST(TextTest, LinesMatchSplitLines) {
+    const std::string longLine(40, 'a');
+    for (const std::string& text : {std::string(), std::string("a"), std::string("a\n"), std::string("\n\n"),
+                                    "one\n" + longLine + "\nthree", longLine + "\n\n" + longLine + "\n"}) {
+        const auto lines = tabulix::splitLines(text);
+        EXPECT_EQ(tabulix::countLines(text), lines.size());
+
+        std::string_view remaining = text;
+        size_t maxWidth = 0;
+        for (const auto line : lines) {
+            EXPECT_EQ(tabulix::nextLine(remaining), line);
+            maxWidth = std::max(maxWidth, line.size());
+        }
+        EXPECT_TRUE(remaining.empty());
+        EXPECT_EQ(tabulix::maxLineWidth(text), maxWidth);
+    }
+}
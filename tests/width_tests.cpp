@@ -0,0 +1,56 @@
+/**
+ * @file width_tests.cpp
+ * @brief Tests for display width measurement
+ */
+
+#include <gtest/gtest.h>
+#include <tabulix/tabulix.hpp>
+#include <string>
+
+TEST(WidthTest, AsciiPrefix) {
+    EXPECT_EQ(tabulix::asciiPrefixLength(""), 0u);
+    EXPECT_EQ(tabulix::asciiPrefixLength("plain ascii text that is longer than a vector"), 45u);
+    EXPECT_EQ(tabulix::asciiPrefixLength("0123456789abcdefgh\xc3\xa9"), 18u);
+}
+
+TEST(WidthTest, DisplayWidth) {
+    EXPECT_EQ(tabulix::displayWidth("hello"), 5u);
+    EXPECT_EQ(tabulix::displayWidth("héllo"), 5u);
+    EXPECT_EQ(tabulix::displayWidth("é"), 1u);
+    EXPECT_EQ(tabulix::displayWidth("日本"), 4u);
+    EXPECT_EQ(tabulix::displayWidth("\U0001F600"), 2u);
+    EXPECT_EQ(tabulix::displayWidth("\U0001F44D\U0001F3FD"), 2u);
+    EXPECT_EQ(tabulix::displayWidth("\U0001F468‍\U0001F469‍\U0001F467"), 2u);
+    EXPECT_EQ(tabulix::displayWidth("\U0001F1FA\U0001F1F8"), 2u);
+    EXPECT_EQ(tabulix::displayWidth("a\xff" "b"), 3u);
+}
+
+TEST(WidthTest, FitToWidth) {
+    const auto fitted = tabulix::fitToWidth("日本語", 5);
+    EXPECT_EQ(fitted.text, "日本");
+    EXPECT_EQ(fitted.width, 4u);
+
+    const auto combined = tabulix::fitToWidth("aéz", 2);
+    EXPECT_EQ(combined.text, "aé");
+    EXPECT_EQ(combined.width, 2u);
+
+    EXPECT_EQ(tabulix::fitToWidth("abcdef", 3).text, "abc");
+    EXPECT_EQ(tabulix::fitToWidth("abc", 10).width, 3u);
+}
+
+TEST(WidthTest, TableAlignsWideText) {
+    tabulix::Table table({"Name", "City"});
+    table.addRow({"山田", "東京"});
+    table.addRow({"René", "Zürich"});
+
+    const std::string expected =
+        "+------+--------+\n"
+        "| Name | City   |\n"
+        "+------+--------+\n"
+        "| 山田 | 東京   |\n"
+        "+------+--------+\n"
+        "| René | Zürich |\n"
+        "+------+--------+\n";
+    const std::string output = table.str();
+    EXPECT_EQ(output, expected);
+}